@@ -48,6 +48,9 @@ check_function_exists(mallinfo HAVE_MALLINFO)
 #HAVE_MALLOC_H
 check_include_files(malloc.h HAVE_MALLOC_H)
 
+#HAVE_SYS_MMAN_H
+check_include_files(sys/mman.h HAVE_SYS_MMAN_H)
+
 #HAVE_SYS_TIMES_H
 check_include_files(sys/times.h HAVE_SYS_TIMES_H)
 
@@ -574,6 +574,56 @@ public:
       const std::vector<BoxContainer>& domain,
       bool do_all_patches = false) const;
 
+   /*!
+    * @brief Compute boundary boxes for all patches on a level, storing
+    * them by local patch index.
+    *
+    * This is the same as the version above, except that the boundary
+    * boxes of the i-th local patch of the level, in the order of
+    * PatchLevel::iterator, are put in boundaries[i].  The vector is
+    * resized to the local number of patches, and the boundaries of
+    * patches that are skipped are left empty.
+    *
+    * @param[out]    boundaries output boundary description
+    * @param[in]     level level on which to generate boundaries
+    * @param[in]     periodic_shift periodic shift for the level
+    *                (see getPeriodicShift())
+    * @param[in]     ghost_width ghost width to compute geometry for the domain
+    * @param[in]     domain Physical domain (in index space of level) for
+    *                computing boundary boxes.
+    * @param[in]     do_all_patches Flag to indicate boundary box computation
+    *                on all patches, even those known to not touch a boundary
+    *
+    * @pre (getDim() == level.getDim()) &&
+    *      (getDim() == periodic_shift.getDim()) &&
+    *      (getDim() == ghost_width.getDim())
+    * @pre ghost_width >= IntVector::getZero(ghost_width.getDim())
+    */
+   void
+   computeBoundaryBoxesOnLevel(
+      std::vector<PatchBoundaries>& boundaries,
+      const PatchLevel& level,
+      const IntVector& periodic_shift,
+      const IntVector& ghost_width,
+      const std::vector<BoxContainer>& domain,
+      bool do_all_patches = false) const;
+
+   /*!
+    * @brief Discard the boundary boxes remembered by
+    * computeBoundaryBoxesOnLevel().
+    *
+    * The boundary boxes of a patch depend only on its box, the domain,
+    * the ghost width and the periodic shift, so computeBoundaryBoxesOnLevel()
+    * keeps those it computes for the last few domains it was given and
+    * reuses them for patches with the same box.  This releases that memory.
+    * It is never needed for correctness.
+    */
+   void
+   clearBoundaryBoxCache() const
+   {
+      d_boundary_box_cache.clear();
+   }
+
    /*!
     * @brief Compute boundary boxes for patch
     *
@@ -1988,6 +2038,99 @@ private:
     */
    bool d_has_enhanced_connectivity;
 
+   /*!
+    * @brief Boundary boxes of one patch remembered in the cache.
+    *
+    * d_box is the patch box they were computed for, and d_last_call
+    * the call of computeBoundaryBoxesOnLevel() that last used them.
+    */
+   struct CachedBoundaries {
+      CachedBoundaries(
+         const Box& box,
+         const PatchBoundaries& boundaries,
+         int last_call):
+         d_box(box),
+         d_boundaries(boundaries),
+         d_last_call(last_call)
+      {
+      }
+
+      Box d_box;
+      PatchBoundaries d_boundaries;
+      int d_last_call;
+   };
+
+   /*!
+    * @brief Boundary boxes computed for one domain, ghost width and
+    * periodic shift.
+    *
+    * Each distinct domain given to computeBoundaryBoxesOnLevel() is a
+    * version of the cache.  Within it, the boundary boxes of a patch are
+    * keyed by the block and extents of the patch box and by the part of
+    * the domain near the patch, relative to the patch, so that patches
+    * placed alike against the boundary share an entry.
+    */
+   struct BoundaryBoxCacheEntry {
+      BoundaryBoxCacheEntry(
+         const std::vector<BoxContainer>& domain,
+         const IntVector& ghost_width,
+         const IntVector& periodic_shift):
+         d_domain(domain),
+         d_ghost_width(ghost_width),
+         d_periodic_shift(periodic_shift),
+         d_num_calls(0)
+      {
+      }
+
+      std::vector<BoxContainer> d_domain;
+      IntVector d_ghost_width;
+      IntVector d_periodic_shift;
+      int d_num_calls;
+      std::map<std::vector<int>, CachedBoundaries> d_boundaries;
+   };
+
+   /*!
+    * @brief Return the cache version for a domain, ghost width and
+    * periodic shift, creating it if needed.
+    *
+    * The version returned is moved to the front of d_boundary_box_cache.
+    * The least recently used one is dropped when there are more than
+    * s_max_boundary_box_cache_versions.  Entries of the version not
+    * used in its previous call are dropped once it holds many more
+    * than num_patches.
+    */
+   BoundaryBoxCacheEntry&
+   findBoundaryBoxCacheEntry(
+      const std::vector<BoxContainer>& domain,
+      const IntVector& ghost_width,
+      const IntVector& periodic_shift,
+      int num_patches) const;
+
+   /*!
+    * @brief Get the boundary boxes of one patch from a cache version,
+    * computing them with getBoundaryBoxes() if they are not there.
+    *
+    * Boundary boxes cached for another patch with the same extents and
+    * placement relative to the domain boundary are shifted to this one.
+    */
+   void
+   getCachedBoundaryBoxes(
+      PatchBoundaries& patch_boundaries,
+      const Box& box,
+      const BoxContainer& domain_boxes,
+      BoundaryBoxCacheEntry& cache_entry) const;
+
+   /*!
+    * @brief Boundary boxes remembered by computeBoundaryBoxesOnLevel(),
+    * most recently used domain first.
+    */
+   mutable std::list<BoundaryBoxCacheEntry> d_boundary_box_cache;
+
+   /*!
+    * @brief Number of domains for which boundary boxes are remembered.
+    */
+   static const int s_max_boundary_box_cache_versions = 8;
+
    static std::shared_ptr<tbox::Timer> t_find_patches_touching_boundaries;
    static std::shared_ptr<tbox::Timer> t_touching_boundaries_init;
    static std::shared_ptr<tbox::Timer> t_touching_boundaries_loop;
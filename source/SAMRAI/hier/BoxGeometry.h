@@ -15,9 +15,11 @@
 #include "SAMRAI/hier/Box.h"
 #include "SAMRAI/hier/BoxContainer.h"
 #include "SAMRAI/hier/BoxOverlap.h"
+#include "SAMRAI/hier/Index.h"
 #include "SAMRAI/hier/IntVector.h"
 
 #include <memory>
+#include <vector>
 
 namespace SAMRAI {
 namespace hier {
@@ -102,6 +104,11 @@ public:
     * outside of the space covered by dst_restrict_boxes. If dst_restrict_boxes
     * is an empty BoxContainer, then it will have no effect on the overlap
     * calculation.
+    *
+    * Overlaps between geometries that provide a key through
+    * getOverlapCacheKey() are looked up in BoxOverlapCache, so that
+    * the overlap of each configuration of boxes, ghost widths and
+    * shift is computed once and then reused.
     */
    std::shared_ptr<BoxOverlap>
    calculateOverlap(
@@ -110,18 +117,7 @@ public:
       const Box& fill_box,
       const bool overwrite_interior,
       const Transformation& transformation,
-      const BoxContainer& dst_restrict_boxes = BoxContainer()) const
-   {
-      return this->calculateOverlap(
-         *this,
-         src_geometry,
-         src_mask,
-         fill_box,
-         overwrite_interior,
-         transformation,
-         true,
-         dst_restrict_boxes);
-   }
+      const BoxContainer& dst_restrict_boxes = BoxContainer()) const;
 
    /**
     * Calculate the overlap between two box geometry objects given the
@@ -159,6 +155,34 @@ public:
       const BoxContainer& boxes,
       const Transformation& offset) const = 0;
 
+   /**
+    * Append to key the quantities that, together with the type of this
+    * object, determine its overlaps with other geometries up to a shift
+    * of the index space, and set origin to the position of this object.
+    * Two geometries of the same type with equal keys must differ only
+    * by the shift between their origins.  Return false if overlaps with
+    * this object may not be cached, which is what the default
+    * implementation does.  A subclass with data affecting its overlaps
+    * must append that data or return false.
+    */
+   virtual bool
+   getOverlapCacheKey(
+      std::vector<int>& key,
+      Index& origin) const;
+
+protected:
+   /**
+    * Append the extents and block of a box and a ghost width to a key
+    * for getOverlapCacheKey(), and set origin to the lower corner of
+    * the box.
+    */
+   static void
+   appendToOverlapCacheKey(
+      std::vector<int>& key,
+      Index& origin,
+      const Box& box,
+      const IntVector& ghosts);
+
 private:
    BoxGeometry(
       const BoxGeometry&);              // not implemented
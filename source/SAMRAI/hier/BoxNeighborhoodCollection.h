@@ -35,6 +35,20 @@ namespace hier {
  * neighborhood of the base Box.  This class describes the neighborhoods of a
  * collection of base Boxes.  Each base Box in the collection has a
  * neighborhood of adjacent head Boxes.
+ *
+ * The collection has two internal representations.  While neighborhoods are
+ * being built or edited the collection uses a set of tree based containers
+ * which allow cheap insertion and removal.  Once a collection is complete,
+ * compress() converts it to a compressed sparse row (CSR) form consisting of
+ * the sorted base BoxIds, an offset for each base Box into a list of neighbor
+ * indices and a deduplicated, sorted pool of head Boxes.  The compressed form
+ * uses a small fraction of the memory of the tree form and is faster to
+ * traverse.  Const access (ConstIterator, ConstNeighborIterator, find,
+ * numNeighbors, hasNeighbor, ...) works directly on the compressed form.  Any
+ * non-const access which can lead to modification (Iterator,
+ * NeighborIterator, insert, erase, ...) transparently converts the collection
+ * back to the tree form first, which invalidates all outstanding
+ * ConstIterators and ConstNeighborIterators.
  */
 class BoxNeighborhoodCollection
 {
@@ -129,6 +143,78 @@ private:
     */
    HeadBoxLinkCt d_nbr_link_ct;
 
+   /*!
+    * @brief True if the collection is in its compressed sparse row form.
+    *
+    * When true the tree based members above are empty and the neighborhoods
+    * are held in the d_csr_* members below.
+    */
+   bool d_compressed;
+
+   /*!
+    * @brief The sorted BoxIds of base Boxes in compressed form.
+    */
+   std::vector<BoxId> d_csr_base_boxes;
+
+   /*!
+    * @brief Offsets into d_csr_nbr_indices of the neighborhood of each base
+    * Box.  The neighbors of base Box i are at positions
+    * [d_csr_offsets[i], d_csr_offsets[i+1]) of d_csr_nbr_indices.
+    */
+   std::vector<int> d_csr_offsets;
+
+   /*!
+    * @brief Indices into d_csr_nbrs of the neighbors of each base Box.
+    * Within each neighborhood the indices are increasing so neighbors are
+    * visited in BoxId order just as in the tree form.
+    */
+   std::vector<int> d_csr_nbr_indices;
+
+   /*!
+    * @brief The deduplicated pool of head Boxes in compressed form, sorted by
+    * BoxId.
+    */
+   std::vector<Box> d_csr_nbrs;
+
+   /*!
+    * @brief Convert the compressed form back to the tree form so that the
+    * collection may be edited.  A no-op if the collection is not
+    * compressed.
+    */
+   void
+   uncompress()
+   {
+      if (d_compressed) {
+         privateUncompress();
+      }
+   }
+
+   /*!
+    * @brief Does the work of uncompress().
+    */
+   void
+   privateUncompress();
+
+   /*!
+    * @brief Returns the index in d_csr_base_boxes of base_box_id or the
+    * number of base Boxes if base_box_id is not a base Box.
+    *
+    * @pre d_compressed
+    */
+   int
+   findCompressedBaseBox(
+      const BoxId& base_box_id) const;
+
+   /*!
+    * @brief Returns the index in d_csr_nbrs of the head Box with the same
+    * BoxId as nbr or -1 if there is no such head Box.
+    *
+    * @pre d_compressed
+    */
+   int
+   findCompressedNeighbor(
+      const Box& nbr) const;
+
 public:
    // Constructors.
 
@@ -250,8 +336,13 @@ public:
          const ConstIterator& rhs)
       {
          d_collection = rhs.d_collection;
-         d_itr = rhs.d_itr;
-         d_base_boxes_itr = rhs.d_base_boxes_itr;
+         d_compressed = rhs.d_compressed;
+         if (d_compressed) {
+            d_csr_idx = rhs.d_csr_idx;
+         } else {
+            d_itr = rhs.d_itr;
+            d_base_boxes_itr = rhs.d_base_boxes_itr;
+         }
          return *this;
       }
 
@@ -265,6 +356,7 @@ public:
          const Iterator& rhs)
       {
          d_collection = rhs.d_collection;
+         d_compressed = false;
          d_itr = rhs.d_itr;
          d_base_boxes_itr = rhs.d_base_boxes_itr;
          return *this;
@@ -286,6 +378,9 @@ public:
       const BoxId&
       operator * () const
       {
+         if (d_compressed) {
+            return d_collection->d_csr_base_boxes[d_csr_idx];
+         }
          return *(d_itr->first);
       }
 
@@ -296,6 +391,9 @@ public:
       const BoxId *
       operator -> () const
       {
+         if (d_compressed) {
+            return &d_collection->d_csr_base_boxes[d_csr_idx];
+         }
          return d_itr->first;
       }
 
@@ -309,10 +407,7 @@ public:
       {
          // Go to the next base Box.
          ConstIterator tmp = *this;
-         if (d_base_boxes_itr != d_collection->d_base_boxes.end()) {
-            ++d_base_boxes_itr;
-            ++d_itr;
-         }
+         ++(*this);
          return tmp;
       }
 
@@ -324,7 +419,12 @@ public:
       operator ++ ()
       {
          // Go to the next base Box.
-         if (d_base_boxes_itr != d_collection->d_base_boxes.end()) {
+         if (d_compressed) {
+            if (d_csr_idx <
+                static_cast<int>(d_collection->d_csr_base_boxes.size())) {
+               ++d_csr_idx;
+            }
+         } else if (d_base_boxes_itr != d_collection->d_base_boxes.end()) {
             ++d_base_boxes_itr;
             ++d_itr;
          }
@@ -340,8 +440,14 @@ public:
       operator == (
          const ConstIterator& rhs) const
       {
-         return d_collection == rhs.d_collection &&
-                d_itr == rhs.d_itr &&
+         if (d_collection != rhs.d_collection ||
+             d_compressed != rhs.d_compressed) {
+            return false;
+         }
+         if (d_compressed) {
+            return d_csr_idx == rhs.d_csr_idx;
+         }
+         return d_itr == rhs.d_itr &&
                 d_base_boxes_itr == rhs.d_base_boxes_itr;
       }
 
@@ -373,11 +479,31 @@ private:
          const BoxNeighborhoodCollection& nbrhds,
          AdjListConstItr itr);
 
+      /*!
+       * @brief Constructs an iterator pointing to the base Box at position
+       * csr_idx of a compressed nbrhds.  Should only be called by
+       * BoxNeighborhoodCollection.
+       *
+       * @param nbrhds
+       *
+       * @param csr_idx
+       */
+      ConstIterator(
+         const BoxNeighborhoodCollection& nbrhds,
+         int csr_idx);
+
       const BoxNeighborhoodCollection* d_collection;
 
+      // True if iterating over the compressed form of d_collection.
+      bool d_compressed;
+
+      // Tree form position, valid if !d_compressed.
       AdjListConstItr d_itr;
 
       BaseBoxPoolItr d_base_boxes_itr;
+
+      // Compressed form position, valid if d_compressed.
+      int d_csr_idx;
    };
 
    class NeighborIterator;
@@ -600,7 +726,13 @@ public:
       {
          d_collection = rhs.d_collection;
          d_base_box = rhs.d_base_box;
-         d_itr = rhs.d_itr;
+         d_compressed = rhs.d_compressed;
+         if (d_compressed) {
+            d_csr_base_idx = rhs.d_csr_base_idx;
+            d_csr_pos = rhs.d_csr_pos;
+         } else {
+            d_itr = rhs.d_itr;
+         }
          return *this;
       }
 
@@ -615,6 +747,7 @@ public:
       {
          d_collection = rhs.d_collection;
          d_base_box = rhs.d_base_box;
+         d_compressed = false;
          d_itr = rhs.d_itr;
          return *this;
       }
@@ -635,6 +768,10 @@ public:
       const Box&
       operator * () const
       {
+         if (d_compressed) {
+            return d_collection->d_csr_nbrs[
+                      d_collection->d_csr_nbr_indices[d_csr_pos]];
+         }
          return *(*d_itr);
       }
 
@@ -645,6 +782,10 @@ public:
       const Box *
       operator -> () const
       {
+         if (d_compressed) {
+            return &d_collection->d_csr_nbrs[
+                      d_collection->d_csr_nbr_indices[d_csr_pos]];
+         }
          return *d_itr;
       }
 
@@ -657,9 +798,7 @@ public:
          int)
       {
          ConstNeighborIterator tmp = *this;
-         if (d_itr != d_collection->d_adj_list.find(d_base_box)->second.end()) {
-            ++d_itr;
-         }
+         ++(*this);
          return tmp;
       }
 
@@ -670,7 +809,12 @@ public:
       ConstNeighborIterator&
       operator ++ ()
       {
-         if (d_itr != d_collection->d_adj_list.find(d_base_box)->second.end()) {
+         if (d_compressed) {
+            if (d_csr_pos < d_collection->d_csr_offsets[d_csr_base_idx + 1]) {
+               ++d_csr_pos;
+            }
+         } else if (d_itr !=
+                    d_collection->d_adj_list.find(d_base_box)->second.end()) {
             ++d_itr;
          }
          return *this;
@@ -685,8 +829,15 @@ public:
       operator == (
          const ConstNeighborIterator& rhs) const
       {
-         return d_collection == rhs.d_collection &&
-                d_base_box == rhs.d_base_box &&
+         if (d_collection != rhs.d_collection ||
+             d_compressed != rhs.d_compressed) {
+            return false;
+         }
+         if (d_compressed) {
+            return d_csr_base_idx == rhs.d_csr_base_idx &&
+                   d_csr_pos == rhs.d_csr_pos;
+         }
+         return d_base_box == rhs.d_base_box &&
                 d_itr == rhs.d_itr;
       }
 
@@ -710,7 +861,17 @@ private:
 
       const BoxId* d_base_box;
 
+      // True if iterating over the compressed form of d_collection.
+      bool d_compressed;
+
+      // Tree form position, valid if !d_compressed.
       NeighborhoodConstItr d_itr;
+
+      // Compressed form base Box index and neighbor position, valid if
+      // d_compressed.
+      int d_csr_base_idx;
+
+      int d_csr_pos;
    };
 
    /*!
@@ -864,6 +1025,7 @@ private:
    Iterator
    begin()
    {
+      uncompress();
       return Iterator(*this);
    }
 
@@ -884,6 +1046,7 @@ private:
    Iterator
    end()
    {
+      uncompress();
       return Iterator(*this, false);
    }
 
@@ -1041,6 +1204,9 @@ private:
    find(
       const BoxId& base_box_id) const
    {
+      if (d_compressed) {
+         return ConstIterator(*this, findCompressedBaseBox(base_box_id));
+      }
       BaseBoxPoolItr base_boxes_itr = d_base_boxes.find(base_box_id);
       if (base_boxes_itr == d_base_boxes.end()) {
          return end();
@@ -1060,6 +1226,7 @@ private:
    find(
       const BoxId& base_box_id)
    {
+      uncompress();
       BaseBoxPoolItr base_boxes_itr = d_base_boxes.find(base_box_id);
       if (base_boxes_itr == d_base_boxes.end()) {
          return end();
@@ -1084,6 +1251,9 @@ private:
    bool
    empty() const
    {
+      if (d_compressed) {
+         return d_csr_base_boxes.empty();
+      }
       return d_base_boxes.empty();
    }
 
@@ -1093,6 +1263,9 @@ private:
    int
    numBoxNeighborhoods() const
    {
+      if (d_compressed) {
+         return static_cast<int>(d_csr_base_boxes.size());
+      }
       return static_cast<int>(d_base_boxes.size());
    }
 
@@ -1124,6 +1297,10 @@ private:
    {
       TBOX_ASSERT(base_box_itr.d_collection == this);
       TBOX_ASSERT(base_box_itr != end());
+      if (d_compressed) {
+         return d_csr_offsets[base_box_itr.d_csr_idx] ==
+                d_csr_offsets[base_box_itr.d_csr_idx + 1];
+      }
       return base_box_itr.d_itr->second.empty();
    }
 
@@ -1155,6 +1332,10 @@ private:
    {
       TBOX_ASSERT(base_box_itr.d_collection == this);
       TBOX_ASSERT(base_box_itr != end());
+      if (d_compressed) {
+         return d_csr_offsets[base_box_itr.d_csr_idx + 1] -
+                d_csr_offsets[base_box_itr.d_csr_idx];
+      }
       return static_cast<int>(base_box_itr.d_itr->second.size());
    }
 
@@ -1257,6 +1438,45 @@ private:
       ConstIterator& itr,
       std::set<int>& owners) const;
 
+   //@{
+   /*!
+    * @name Compressed storage
+    */
+
+   /*!
+    * @brief Convert the collection to its compressed sparse row form.
+    *
+    * Call this once the neighborhoods are complete and the collection is
+    * expected to be mostly read.  The compressed form is converted back to
+    * the editable tree form automatically by any non-const access which may
+    * modify the collection.  Calling compress() on an already compressed
+    * collection is a no-op.
+    */
+   void
+   compress();
+
+   /*!
+    * @brief Returns true if the collection is in its compressed sparse row
+    * form.
+    */
+   bool
+   isCompressed() const
+   {
+      return d_compressed;
+   }
+
+   /*!
+    * @brief Returns an estimate of the number of bytes of heap memory used
+    * to hold the neighborhoods in their current form.
+    *
+    * The estimate for the tree form counts the elements of each container
+    * plus a per-node overhead typical of node based standard containers.
+    */
+   size_t
+   getMemoryFootprint() const;
+
+   //@}
+
    //@{
    /*!
     * @name Neighborhood editing
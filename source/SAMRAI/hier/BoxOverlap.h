@@ -15,6 +15,8 @@
 #include "SAMRAI/hier/IntVector.h"
 #include "SAMRAI/hier/Transformation.h"
 
+#include <memory>
+
 namespace SAMRAI {
 namespace hier {
 
@@ -90,6 +92,25 @@ public:
    virtual const Transformation&
    getTransformation() const = 0;
 
+   /*!
+    * @brief Return a copy of this overlap with its destination region
+    * shifted and with another transformation.
+    *
+    * This is used by BoxOverlapCache to reuse an overlap computed
+    * between geometries that differ from the requested ones only by a
+    * shift.  The default implementation returns a null pointer, meaning
+    * that overlaps of this type are not cached.
+    *
+    * @param[in]     shift the shift of the destination index space
+    * @param[in]     transformation the transformation of the copy
+    *
+    * @return  The shifted copy, or a null pointer.
+    */
+   virtual std::shared_ptr<BoxOverlap>
+   cloneShifted(
+      const IntVector& shift,
+      const Transformation& transformation) const;
+
    /*!
     * @brief Print BoxOverlap object data.
     *
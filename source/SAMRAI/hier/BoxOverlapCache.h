@@ -0,0 +1,296 @@
+/*************************************************************************
+ *
+ * This file is part of the SAMRAI distribution.  For full copyright
+ * information, see COPYRIGHT and LICENSE.
+ *
+ * Copyright:     (c) 1997-2020 Lawrence Livermore National Security, LLC
+ * Description:   Cache of overlaps between box geometries
+ *
+ ************************************************************************/
+
+#ifndef included_hier_BoxOverlapCache
+#define included_hier_BoxOverlapCache
+
+#include "SAMRAI/SAMRAI_config.h"
+
+#include "SAMRAI/hier/Box.h"
+#include "SAMRAI/hier/BoxContainer.h"
+#include "SAMRAI/hier/BoxOverlap.h"
+#include "SAMRAI/hier/Transformation.h"
+#include "SAMRAI/tbox/OpenMPUtilities.h"
+
+#include <atomic>
+#include <cstddef>
+#include <iostream>
+#include <list>
+#include <memory>
+#include <typeindex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace SAMRAI {
+namespace hier {
+
+class BoxGeometry;
+
+/*!
+ * @brief Cache of the overlaps computed between box geometries.
+ *
+ * Building refine and coarsen schedules calls
+ * BoxGeometry::calculateOverlap() for every pair of neighboring
+ * patches and every variable.  On a level of equally sized patches,
+ * most of these calls differ only by a shift of the index space: the
+ * boxes have the same shape, the same ghost widths and the same
+ * position relative to each other.  The cache computes the overlap of
+ * each such configuration once and answers later requests with a
+ * shifted copy.
+ *
+ * The key of a request holds the types of the two geometries, the
+ * data each provides through BoxGeometry::getOverlapCacheKey(), the
+ * source mask, fill box and destination restriction boxes relative to
+ * the geometries, the overwrite flag and the offset between the
+ * geometries.  Requests are computed directly, without the cache, when
+ * a geometry provides no key, when the transformation has a rotation
+ * or when the overlap type does not implement
+ * BoxOverlap::cloneShifted().
+ *
+ * The cache holds at most getMaxEntries() overlaps and discards the
+ * least recently used one when full.  Statistics on lookups and hits
+ * are written by printStatistics().
+ *
+ * There is a single cache, accessed with getCache().  It is safe to
+ * use from multiple threads.
+ */
+class BoxOverlapCache
+{
+public:
+   /*!
+    * @brief Return the cache.
+    */
+   static BoxOverlapCache *
+   getCache();
+
+   /*!
+    * @brief Compute the overlap of two geometries, or return a copy of
+    * a cached one.
+    *
+    * The arguments and result are those of
+    * BoxGeometry::calculateOverlap().
+    */
+   std::shared_ptr<BoxOverlap>
+   calculateOverlap(
+      const BoxGeometry& dst_geometry,
+      const BoxGeometry& src_geometry,
+      const Box& src_mask,
+      const Box& fill_box,
+      const bool overwrite_interior,
+      const Transformation& transformation,
+      const BoxContainer& dst_restrict_boxes);
+
+   /*!
+    * @brief Set whether overlaps are cached.
+    *
+    * When disabled, the cache is emptied and every overlap is computed.
+    * This may be changed at any time.
+    *
+    * @param[in] enabled @b Default: true
+    */
+   void
+   setEnabled(
+      bool enabled)
+   {
+      d_enabled = enabled;
+      if (!enabled) {
+         clear();
+      }
+   }
+
+   /*!
+    * @brief Return whether overlaps are cached.
+    */
+   bool
+   isEnabled() const
+   {
+      return d_enabled;
+   }
+
+   /*!
+    * @brief Set the most overlaps the cache may hold.
+    *
+    * @param[in] max_entries @b Default: 4096
+    */
+   void
+   setMaxEntries(
+      size_t max_entries);
+
+   /*!
+    * @brief Return the most overlaps the cache may hold.
+    */
+   size_t
+   getMaxEntries() const
+   {
+      return d_max_entries;
+   }
+
+   /*!
+    * @brief Return the number of overlaps held.
+    */
+   size_t
+   getNumberOfEntries() const;
+
+   /*!
+    * @brief Remove all overlaps from the cache.
+    */
+   void
+   clear();
+
+   /*!
+    * @brief Return the number of requests that were looked up in the
+    * cache.
+    */
+   size_t
+   getNumberOfLookups() const
+   {
+      return d_num_lookups;
+   }
+
+   /*!
+    * @brief Return the number of requests answered from the cache.
+    */
+   size_t
+   getNumberOfHits() const
+   {
+      return d_num_hits;
+   }
+
+   /*!
+    * @brief Return the number of requests that could not be cached.
+    */
+   size_t
+   getNumberOfUncachedRequests() const
+   {
+      return d_num_uncached;
+   }
+
+   /*!
+    * @brief Return the number of overlaps discarded to make room for
+    * others.
+    */
+   size_t
+   getNumberOfEvictions() const
+   {
+      return d_num_evictions;
+   }
+
+   /*!
+    * @brief Return the fraction of lookups answered from the cache.
+    */
+   double
+   getHitRate() const;
+
+   /*!
+    * @brief Reset the request counters.
+    */
+   void
+   resetStatistics();
+
+   /*!
+    * @brief Write the statistics to a stream.
+    *
+    * @param[in,out] os
+    */
+   void
+   printStatistics(
+      std::ostream& os) const;
+
+private:
+   /*
+    * Key of a request: the geometry types and the integers describing
+    * the request relative to the destination geometry.
+    */
+   struct Key {
+      Key(
+         const std::type_index& dst_type,
+         const std::type_index& src_type):
+         d_dst_type(dst_type),
+         d_src_type(src_type)
+      {
+      }
+
+      bool
+      operator == (
+         const Key& rhs) const
+      {
+         return d_dst_type == rhs.d_dst_type &&
+                d_src_type == rhs.d_src_type &&
+                d_values == rhs.d_values;
+      }
+
+      std::type_index d_dst_type;
+      std::type_index d_src_type;
+      std::vector<int> d_values;
+   };
+
+   struct KeyHash {
+      size_t
+      operator () (
+         const Key& key) const;
+   };
+
+   /*
+    * Entries in order of use, most recent first, with the overlaps
+    * stored relative to the destination origin.
+    */
+   typedef std::list<std::pair<Key, std::shared_ptr<const BoxOverlap> > >
+      EntryList;
+
+   typedef std::unordered_map<Key, EntryList::iterator, KeyHash> EntryMap;
+
+   BoxOverlapCache();
+
+   ~BoxOverlapCache();
+
+   // Unimplemented copy constructor.
+   BoxOverlapCache(
+      const BoxOverlapCache& other);
+
+   // Unimplemented assignment operator.
+   BoxOverlapCache&
+   operator = (
+      const BoxOverlapCache& rhs);
+
+   /*!
+    * @brief Append the corners and block of a box, relative to an
+    * origin, to a key.
+    */
+   static void
+   appendBox(
+      std::vector<int>& values,
+      const Box& box,
+      const Index& origin);
+
+   /*!
+    * @brief Discard least recently used entries until there are at
+    * most d_max_entries.  The lock must be held.
+    */
+   void
+   evictEntries();
+
+   EntryList d_entries;
+   EntryMap d_entry_map;
+   TBOX_omp_lock_t d_lock;
+
+   bool d_enabled;
+   size_t d_max_entries;
+
+   std::atomic<size_t> d_num_lookups;
+   std::atomic<size_t> d_num_hits;
+   std::atomic<size_t> d_num_uncached;
+   std::atomic<size_t> d_num_evictions;
+};
+
+}
+}
+
+#endif
@@ -71,6 +71,17 @@ public:
    resetStatistics(
       const tbox::Dimension& dim);
 
+   /*!
+    * @brief Add the search statistics of the calling thread to those
+    * reported by printStatistics().
+    *
+    * Searches are counted by each thread separately, so that threads
+    * searching at once do not contend for the counts.  A parallel region
+    * that searches trees calls this from each of its threads at its end.
+    */
+   static void
+   mergeThreadSearchStatistics();
+
    /*!
     * @brief Destructor.
     */
@@ -346,6 +357,17 @@ private:
    static unsigned int s_max_found_box[SAMRAI::MAX_DIM_VAL];
    static unsigned int s_max_lin_search[SAMRAI::MAX_DIM_VAL];
 
+   /*
+    * Search statistics of the calling thread, not yet added to the ones
+    * above.
+    */
+   static unsigned int s_thread_num_search[SAMRAI::MAX_DIM_VAL];
+   static unsigned int s_thread_num_found_box[SAMRAI::MAX_DIM_VAL];
+   static unsigned int s_thread_max_found_box[SAMRAI::MAX_DIM_VAL];
+#ifdef HAVE_OPENMP
+#pragma omp threadprivate(s_thread_num_search, s_thread_num_found_box, s_thread_max_found_box)
+#endif
+
    static tbox::StartupShutdownManager::Handler
       s_initialize_finalize_handler;
 
@@ -128,6 +128,7 @@ public:
    void
    clear()
    {
+      d_patch_ids.clear();
       d_boundary_boxes.clear();
    }
 
@@ -251,6 +252,7 @@ public:
       const CoarseFineBoundary& rhs)
    {
       d_initialized = rhs.d_initialized;
+      d_patch_ids = rhs.d_patch_ids;
       d_boundary_boxes = rhs.d_boundary_boxes;
       return *this;
    }
@@ -322,6 +324,33 @@ private:
       const Connector& level_to_level,
       const IntVector& max_ghost_width);
 
+   /*!
+    * @brief Find the overlap Connector from base to head with at least
+    * the given width, building it with the assumed partition rendezvous
+    * search if there is none.
+    *
+    * Neither BoxLevel is globalized to build the Connector, which is
+    * cached with base for later users.
+    *
+    * @param[in] base
+    * @param[in] head
+    * @param[in] width
+    */
+   static const Connector&
+   findRendezvousConnector(
+      const BoxLevel& base,
+      const BoxLevel& head,
+      const IntVector& width);
+
+   /*!
+    * @brief Set d_patch_ids to the BoxIds of the local patches of a level.
+    *
+    * @param[in] level
+    */
+   void
+   setPatchIds(
+      const PatchLevel& level);
+
    /*!
     * @brief Dimension of the object.
     */
@@ -333,12 +362,18 @@ private:
     */
    std::vector<bool> d_initialized;
 
+   /*!
+    * @brief BoxIds of the local patches, in increasing order.
+    */
+   std::vector<BoxId> d_patch_ids;
+
    /*!
     * @brief Patch boundary boxes describing the coarse-fine boundary.
     *
-    * Map each local patch to a PatchBoundaries object.
+    * Entry i holds the boundary boxes of the patch d_patch_ids[i], which
+    * is the i-th local patch of the level.
     */
-   std::map<BoxId, PatchBoundaries> d_boundary_boxes;
+   std::vector<PatchBoundaries> d_boundary_boxes;
 
 };
 
@@ -710,6 +710,33 @@ public:
       d_relationships.growNeighbors(growth);
    }
 
+   /*!
+    * @brief Convert the local neighborhoods to their compact, read-optimized
+    * form.
+    *
+    * The Connector remains fully usable.  Any subsequent modification of
+    * the neighborhoods converts them back to the editable form.
+    *
+    * @see BoxNeighborhoodCollection::compress()
+    */
+   void
+   compressNeighborhoods()
+   {
+      d_relationships.compress();
+   }
+
+   /*!
+    * @brief Returns an estimate of the number of bytes of heap memory used
+    * by the local neighborhoods.
+    *
+    * @see BoxNeighborhoodCollection::getMemoryFootprint()
+    */
+   size_t
+   getLocalMemoryFootprint() const
+   {
+      return d_relationships.getMemoryFootprint();
+   }
+
    //@}
 
    /*!
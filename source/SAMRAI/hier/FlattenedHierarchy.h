@@ -16,6 +16,7 @@
 #include "SAMRAI/hier/HierarchyNeighbors.h"
 #include "SAMRAI/hier/PatchHierarchy.h"
 
+#include <algorithm>
 #include <string>
 #include <vector>
 #include <memory>
@@ -38,6 +39,10 @@ namespace hier {
  * entirely covered by Patches on a finer level, the container will be empty.
  * If the Patch's index space is partially covered by a finer level, then
  * the container will hold boxes that compose the uncovered parts of the Patch.
+ *
+ * After a regrid that changes only the finer levels of the hierarchy,
+ * update() recomputes the visible boxes of the changed levels and of the
+ * level just coarser than them, and leaves the others as they are.
  */
 class FlattenedHierarchy
 {
@@ -71,6 +76,34 @@ public:
     */ 
    ~FlattenedHierarchy();
 
+   /*!
+    * @brief Bring the flattened representation up to date after levels of
+    * the hierarchy have changed.
+    *
+    * Levels coarsest_changed_level and finer are taken to have been
+    * changed or created or removed, as by a regrid of the levels finer
+    * than coarsest_changed_level-1.  Only the visible boxes of those
+    * levels and of level coarsest_changed_level-1 are recomputed.  The
+    * result is the same as that of constructing a new object with the
+    * same coarsest level and the given finest level.
+    *
+    * @param hierarchy        PatchHierarchy that will be represented.  It
+    *                         may be a different object from the one given
+    *                         to the constructor if it has the same levels
+    *                         coarser than coarsest_changed_level.
+    * @param coarsest_changed_level  The coarsest level that has changed
+    * @param finest_level     The finest level that will be used
+    *
+    * @pre coarsest_changed_level >= 0
+    * @pre getCoarsestLevelNumber() <= finest_level
+    * @pre finest_level < hierarchy->getNumberOfLevels()
+    */
+   void
+   update(
+      const PatchHierarchy& hierarchy,
+      int coarsest_changed_level,
+      int finest_level);
+
    /*!
     * @brief Get the coarsest level number represented by this object
     */
@@ -105,16 +138,17 @@ public:
    {
       TBOX_ASSERT(ln <= d_finest_level && ln >= d_coarsest_level);
 
-      std::map<BoxId, BoxContainer >::const_iterator itr =
-         d_visible_boxes[ln].find(box.getBoxId());
+      const std::vector<BoxId>& patch_ids = d_patch_ids[ln];
+      std::vector<BoxId>::const_iterator itr =
+         std::lower_bound(patch_ids.begin(), patch_ids.end(), box.getBoxId());
 
-      if (itr == d_visible_boxes[ln].end()) {
+      if (itr == patch_ids.end() || *itr != box.getBoxId()) {
          TBOX_ERROR("FlattenedHierarchy::getVisibleBoxes error: Box "
             << box << " does not exist locally on level " << ln << ".\n"
             << "You must specify the Box of a current local patch.");
       }
 
-      return itr->second;
+      return d_visible_boxes[ln][itr - patch_ids.begin()];
    }
 
    /*
@@ -145,20 +179,49 @@ public:
 
 private:
 
+   /*!
+    * @brief Compute the visible boxes of the local patches of a level.
+    *
+    * The boxes are given LocalIds later by numberVisibleBoxes().
+    *
+    * @param hierarchy
+    * @param ln  Level number
+    */
+   void
+   computeLevelVisibleBoxes(
+      const PatchHierarchy& hierarchy,
+      int ln);
+
+   /*!
+    * @brief Give the visible boxes LocalIds counting up from zero, from
+    * the finest level to the coarsest and in order of patches within a
+    * level.
+    */
+   void
+   numberVisibleBoxes();
+
    /*!
     * Level numbers for the range of levels represented in this object.
     */
    int d_coarsest_level;
    int d_finest_level;
 
+   /*!
+    * @brief BoxIds of the local patches of each level, in increasing
+    * order.
+    *
+    * The vector is indexed by level number.
+    */
+   std::vector<std::vector<BoxId> > d_patch_ids;
+
    /*!
     * @brief Container for the boxes in the flattened hierarchy representation
     *
-    * The vector is indexed by level number, and for each level, the BoxId
-    * of a Patch is mapped to a BoxContainer holding the visible parts of
-    * that Patch's box.
+    * The vector is indexed by level number, and for each level by the
+    * position of a Patch's BoxId in d_patch_ids.  Each entry holds the
+    * visible parts of that Patch's box.
     */
-   std::vector< std::map<BoxId, BoxContainer> > d_visible_boxes;
+   std::vector<std::vector<BoxContainer> > d_visible_boxes;
 
    /*!
     * @brief Pointer to the PatchHierarchy that was used to create this object.
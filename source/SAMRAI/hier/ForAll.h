@@ -4,7 +4,7 @@
  * information, see COPYRIGHT and LICENSE.
  *
  * Copyright:     (c) 1997-2020 Lawrence Livermore National Security, LLC
- * Description:   Class to record statistics during program execution.
+ * Description:   Loop abstractions over integer ranges and hier::Box
  *
  ************************************************************************/
 
@@ -15,10 +15,13 @@
 
 #if defined(HAVE_RAJA)
 #include "RAJA/RAJA.hpp"
+#endif
 
 #include "SAMRAI/hier/Box.h"
 #include "SAMRAI/hier/Index.h"
 #include "SAMRAI/tbox/ExecutionPolicy.h"
+#include "SAMRAI/tbox/OpenMPUtilities.h"
+#include "SAMRAI/tbox/SAMRAIManager.h"
 
 #include <type_traits>
 #include <tuple>
@@ -30,7 +33,8 @@ namespace hier
 {
 
 /*!
- * Two looping structures for use with RAJA policies are provided
+ * Two looping structures for use with the policies of
+ * tbox/ExecutionPolicy.h are provided
  *
  * parallel_for_all() uses a default parallel policy based on the
  * configuration used build SAMRAI.  If SAMRAI is confugured with cuda,
@@ -53,7 +57,7 @@ namespace hier
  * \endverbatim
  *
  * for_all<policy>() uses a template to allow the calling code to choose
- * a custom RAJA policy.  Usage is similar, as it also loops over a hier::Box.
+ * a custom policy.  Usage is similar, as it also loops over a hier::Box.
  *
  * \verbatim
  *
@@ -62,6 +66,22 @@ namespace hier
  *
  * \endverbatim
  *
+ * When SAMRAI is built with RAJA, the loops are RAJA kernels and a RAJA
+ * policy may also be given to for_all<policy>().  Otherwise the loops
+ * are implemented here with plain loops, threaded with OpenMP under the
+ * parallel and tiled policies, and only the policies of
+ * tbox/ExecutionPolicy.h may be given.  In both cases the first loop
+ * index is the fastest varying in memory, so the body should be written
+ * for the i index to be innermost.  A native parallel loop started from
+ * inside an OpenMP parallel region, such as a threaded loop over
+ * patches, runs on the calling thread.
+ *
+ * Native 2D and 3D loops under the parallel policy are run over tiles
+ * whose size is set at run time with
+ * tbox::SAMRAIManager::setLoopTileSize() or the loop_tile_size input
+ * of tbox::SAMRAIManager::getFromInput(); by default the tiles are rows
+ * of the box.
+ *
  */
 
 namespace detail
@@ -103,6 +123,8 @@ struct function_traits<R (T::*)(Args...) const> {
    enum { argument_count = sizeof...(Args) };
 };
 
+#if defined(HAVE_RAJA)
+
 inline RAJA::RangeSegment make_range(const hier::Index& ifirst, const hier::Index& ilast, std::size_t index)
 {
    return RAJA::RangeSegment(ifirst(index), ilast(index) + 1);
@@ -181,8 +203,143 @@ struct for_all<3> {
    }
 };
 
+#else // HAVE_RAJA
+
+/*
+ * Return the extent of a tile, where a tile size of 0 or larger than
+ * the box means the whole extent n.
+ */
+inline int tile_extent(int tile, int n)
+{
+   return (tile > 0 && tile < n) ? tile : n;
+}
+
+/*
+ * Return the tile size of Policy in direction d.
+ */
+template <typename Policy>
+inline int tile_size(int d)
+{
+   using traits = tbox::detail::policy_traits<Policy>;
+   if (traits::runtime_tiling) {
+      return tbox::SAMRAIManager::getLoopTileSize(d);
+   }
+   return d == 0 ? traits::tile_i : (d == 1 ? traits::tile_j : traits::tile_k);
+}
+
+template <int ArgumentCount>
+struct for_all {
+};
+
+template <>
+struct for_all<1> {
+   template <typename Policy, typename LoopBody>
+   inline static void eval(const hier::Index& ifirst, const hier::Index& ilast, LoopBody body)
+   {
+      const int begin = ifirst(0);
+      const int end = ilast(0) + 1;
+#ifdef _OPENMP
+      using traits = tbox::detail::policy_traits<Policy>;
+#pragma omp parallel for schedule(static) if ( traits::threaded && !omp_in_parallel() && end - begin >= traits::min_parallel_size )
+#endif
+      for (int i = begin; i < end; ++i) {
+         body(i);
+      }
+   }
+};
+
+/*
+ * 2D and 3D loops are run over tiles numbered with the i tiles fastest,
+ * so that with static scheduling each thread gets a contiguous range
+ * of memory when the tiles span the box in i.
+ */
+template <>
+struct for_all<2> {
+   template <typename Policy, typename LoopBody>
+   inline static void eval(const hier::Index& ifirst, const hier::Index& ilast, LoopBody body)
+   {
+      const int ilo = ifirst(0);
+      const int jlo = ifirst(1);
+      const int iend = ilast(0) + 1;
+      const int jend = ilast(1) + 1;
+      const int ni = iend - ilo;
+      const int nj = jend - jlo;
+      if (ni <= 0 || nj <= 0) {
+         return;
+      }
+      const int ti = tile_extent(tile_size<Policy>(0), ni);
+      const int tj = tile_extent(tile_size<Policy>(1), nj);
+      const int nti = (ni + ti - 1) / ti;
+      const int num_tiles = nti * ((nj + tj - 1) / tj);
+#ifdef _OPENMP
+      using traits = tbox::detail::policy_traits<Policy>;
+#pragma omp parallel for schedule(static) if ( traits::threaded && !omp_in_parallel() && num_tiles > 1 && static_cast<long>(ni) * nj >= traits::min_parallel_size )
+#endif
+      for (int t = 0; t < num_tiles; ++t) {
+         const int i0 = ilo + (t % nti) * ti;
+         const int j0 = jlo + (t / nti) * tj;
+         const int i1 = i0 + ti < iend ? i0 + ti : iend;
+         const int j1 = j0 + tj < jend ? j0 + tj : jend;
+         for (int j = j0; j < j1; ++j) {
+            for (int i = i0; i < i1; ++i) {
+               body(i, j);
+            }
+         }
+      }
+   }
+};
+
+template <>
+struct for_all<3> {
+   template <typename Policy, typename LoopBody>
+   inline static void eval(const hier::Index& ifirst, const hier::Index& ilast, LoopBody body)
+   {
+      const int ilo = ifirst(0);
+      const int jlo = ifirst(1);
+      const int klo = ifirst(2);
+      const int iend = ilast(0) + 1;
+      const int jend = ilast(1) + 1;
+      const int kend = ilast(2) + 1;
+      const int ni = iend - ilo;
+      const int nj = jend - jlo;
+      const int nk = kend - klo;
+      if (ni <= 0 || nj <= 0 || nk <= 0) {
+         return;
+      }
+      const int ti = tile_extent(tile_size<Policy>(0), ni);
+      const int tj = tile_extent(tile_size<Policy>(1), nj);
+      const int tk = tile_extent(tile_size<Policy>(2), nk);
+      const int nti = (ni + ti - 1) / ti;
+      const int ntj = (nj + tj - 1) / tj;
+      const int num_tiles = nti * ntj * ((nk + tk - 1) / tk);
+#ifdef _OPENMP
+      using traits = tbox::detail::policy_traits<Policy>;
+#pragma omp parallel for schedule(static) if ( traits::threaded && !omp_in_parallel() && num_tiles > 1 && static_cast<long>(ni) * nj * nk >= traits::min_parallel_size )
+#endif
+      for (int t = 0; t < num_tiles; ++t) {
+         const int i0 = ilo + (t % nti) * ti;
+         const int j0 = jlo + ((t / nti) % ntj) * tj;
+         const int k0 = klo + (t / (nti * ntj)) * tk;
+         const int i1 = i0 + ti < iend ? i0 + ti : iend;
+         const int j1 = j0 + tj < jend ? j0 + tj : jend;
+         const int k1 = k0 + tk < kend ? k0 + tk : kend;
+         for (int k = k0; k < k1; ++k) {
+            for (int j = j0; j < j1; ++j) {
+               for (int i = i0; i < i1; ++i) {
+                  body(i, j, k);
+               }
+            }
+         }
+      }
+   }
+};
+
+#endif // HAVE_RAJA
+
 }  // namespace detail
 
+#if defined(HAVE_RAJA)
+
 // does NOT include end
 template <typename Policy, typename LoopBody,
           typename std::enable_if<std::is_base_of<tbox::policy::base, Policy>::value, int>::type = 0>
@@ -198,6 +355,25 @@ inline void for_all(int begin, int end, LoopBody body)
    RAJA::forall<Policy>(RAJA::RangeSegment(begin, end), body);
 }
 
+#else // HAVE_RAJA
+
+// does NOT include end
+template <typename Policy, typename LoopBody>
+inline void for_all(int begin, int end, LoopBody body)
+{
+   static_assert(std::is_base_of<tbox::policy::base, Policy>::value,
+      "only tbox policies may be used without RAJA");
+#ifdef _OPENMP
+   using traits = tbox::detail::policy_traits<Policy>;
+#pragma omp parallel for schedule(static) if ( traits::threaded && !omp_in_parallel() && end - begin >= traits::min_parallel_size )
+#endif
+   for (int i = begin; i < end; ++i) {
+      body(i);
+   }
+}
+
+#endif // HAVE_RAJA
+
 // does NOT include end
 template <typename LoopBody>
 inline void parallel_for_all(int begin, int end, LoopBody body)
@@ -233,6 +409,4 @@ inline void parallel_for_all(const hier::Box& box, LoopBody body)
 }  // namespace hier
 }  // namespace SAMRAI
 
-#endif
-
 #endif  // included_hier_ForAll
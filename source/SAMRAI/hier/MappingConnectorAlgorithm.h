@@ -235,6 +235,22 @@ public:
    setTimerPrefix(
       const std::string& timer_prefix);
 
+   /*!
+    * @brief Print statistics on how many mappings modify() has been
+    * able to skip because they map a Box to itself.
+    *
+    * The statistics are accumulated alongside the timers, so they
+    * cover all MappingConnectorAlgorithm objects using this object's
+    * timer prefix.
+    *
+    * This method is for developers to analyze performance.
+    *
+    * @param[in,out] os Output stream
+    */
+   void
+   printStatistics(
+      std::ostream& os) const;
+
 private:
    /*!
     * @brief BoxIdSet is a clarifying typedef.
@@ -278,6 +294,23 @@ private:
       BoxLevel* mutable_new,
       BoxLevel* mutable_old) const;
 
+   /*!
+    * @brief Find mappings in old_to_new that map a Box to itself.
+    *
+    * An identity mapping maps an old Box to a single new Box with the
+    * same BoxId, block and index space.  It changes nothing, so modify
+    * treats it the same as a Box not mapped at all.  If identity
+    * mappings are found, changed_old_to_new is set to a copy of
+    * old_to_new without them.  Otherwise, changed_old_to_new is left
+    * unset.
+    *
+    * @return Number of identity mappings found.
+    */
+   int
+   privateModify_removeIdentityMappings(
+      std::shared_ptr<MappingConnector>& changed_old_to_new,
+      const MappingConnector& old_to_new) const;
+
    /*
     * @brief Perform checks on the arguments of modify.
     */
@@ -428,6 +461,15 @@ private:
       std::shared_ptr<tbox::Timer> t_modify_receive_and_unpack;
       std::shared_ptr<tbox::Timer> t_modify_MPI_wait;
       std::shared_ptr<tbox::Timer> t_modify_misc;
+      std::shared_ptr<tbox::Timer> t_modify_find_identity;
+      //! @brief Number of local mappings given to modify.
+      long int num_mappings;
+      //! @brief Number of local identity mappings skipped by modify.
+      long int num_identity_mappings;
+      //! @brief Number of modify calls skipping all communication.
+      int num_communication_skipped;
+      //! @brief Number of modify calls.
+      int num_modify;
    };
 
    //! @brief Default prefix for Timers.
@@ -150,11 +150,37 @@ public:
     * using the assumed partition algorithm to find overlaps.
     *
     * For the assumed partition algorithm, see Allison Baker's paper.
+    * Each base and head Box is registered with the process owning its
+    * region of an assumed partition of the domain, and overlaps are
+    * discovered at that rendezvous process, so neither the base nor the
+    * head is globalized.
     */
    void
    findOverlaps_assumedPartition(
       Connector& connector) const;
 
+   /*!
+    * @brief Create overlap Connector then discover and add overlaps from
+    * base to head using the assumed partition algorithm.
+    *
+    * This is the rendezvous-based alternative to findOverlaps(), which
+    * globalizes the head.  Memory use on each process is proportional to
+    * the local, not global, number of boxes.
+    *
+    * @param[out] connector
+    * @param[in] base_box_level
+    * @param[in] head_box_level
+    * @param[in] base_width
+    *
+    * @pre base_box_level.getMPI().isCongruentWith(head_box_level.getMPI())
+    */
+   void
+   findOverlaps_assumedPartition(
+      std::shared_ptr<Connector>& connector,
+      const BoxLevel& base_box_level,
+      const BoxLevel& head_box_level,
+      const IntVector& base_width) const;
+
    /*!
     * @brief For a given Connector, get the subset of overlapping neighbors
     * defined by the given Connector width.
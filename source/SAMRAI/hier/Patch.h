@@ -143,7 +143,8 @@ public:
     * Typically, this function should only be called to access
     * patch data objects that have already been explicitly allocated through
     * a call to one of the patch allocation routines.  A NULL pointer will
-    * be returned if the patch data object is not allocated.
+    * be returned if the patch data object is not allocated.  A component
+    * allocated on demand is allocated by the first call.
     *
     * @return a pointer to the patch data object associated with the specified
     * identifier.
@@ -157,6 +158,17 @@ public:
       const int id) const
    {
       TBOX_ASSERT((id >= 0) && (id < numPatchData()));
+      if (id < static_cast<int>(d_on_demand.size()) && d_on_demand[id]) {
+         std::shared_ptr<PatchData> data(std::atomic_load(&d_patch_data[id]));
+         if (!data) {
+            data = createOnDemandPatchData(id);
+         }
+#ifdef HAVE_OPENMP
+#pragma omp atomic write
+#endif
+         d_on_demand_used[id] = 1;
+         return data;
+      }
       return d_patch_data[id];
    }
 
@@ -186,8 +198,7 @@ public:
       TBOX_ASSERT_OBJDIM_EQUALITY2(*this, *variable);
       int id = VariableDatabase::getDatabase()->
          mapVariableAndContextToIndex(variable, context);
-      TBOX_ASSERT((id >= 0) && (id < numPatchData()));
-      return d_patch_data[id];
+      return getPatchData(id);
    }
 
    /*!
@@ -222,6 +233,9 @@ public:
    /*!
     * @brief Check whether the specified component has been allocated.
     *
+    * A component allocated on demand counts as allocated even before
+    * its data object is created.
+    *
     * @return True if the component has been allocated.
     *
     * @param[in]  id
@@ -230,7 +244,45 @@ public:
    checkAllocated(
       const int id) const
    {
-      return (id < numPatchData()) && d_patch_data[id];
+      return (id < numPatchData()) &&
+             ((id < static_cast<int>(d_on_demand.size()) && d_on_demand[id]) ||
+              d_patch_data[id]);
+   }
+
+   /*!
+    * @brief Check whether the data object of the specified component
+    * exists.
+    *
+    * This differs from checkAllocated() only for components allocated on
+    * demand that have not been used since they were allocated or
+    * released.
+    *
+    * @param[in]  id
+    */
+   bool
+   checkDataInMemory(
+      const int id) const
+   {
+      if (id >= numPatchData()) {
+         return false;
+      }
+      if (id < static_cast<int>(d_on_demand.size()) && d_on_demand[id]) {
+         return static_cast<bool>(std::atomic_load(&d_patch_data[id]));
+      }
+      return static_cast<bool>(d_patch_data[id]);
+   }
+
+   /*!
+    * @brief Check whether the specified component is allocated on
+    * demand.
+    *
+    * @param[in]  id
+    */
+   bool
+   checkAllocatedOnDemand(
+      const int id) const
+   {
+      return (id < static_cast<int>(d_on_demand.size())) && d_on_demand[id];
    }
 
    /*!
@@ -290,6 +342,62 @@ public:
       const ComponentSelector& components,
       const double time = 0.0);
 
+   /*!
+    * @brief Allocate the specified component on demand.
+    *
+    * Only the intent to allocate is recorded.  The data object is created
+    * from the PatchDataFactory the first time getPatchData() is called for
+    * the component, which includes its first use by a communication
+    * transaction, and is given the time set here or by setTime().  Until
+    * then its size is counted as deferred memory by
+    * tbox::MemoryUtilities.  A component that is already allocated is
+    * only given the new time.
+    *
+    * @param[in]  id
+    * @param[in]  time
+    *
+    * @pre (id >= 0) && (id < getPatchDescriptor()->getMaxNumberRegisteredComponents())
+    *
+    * @see releaseIdlePatchData()
+    */
+   void
+   allocatePatchDataOnDemand(
+      const int id,
+      const double time = 0.0);
+
+   /*!
+    * @brief Allocate the specified components on demand.
+    *
+    * @param[in]  components
+    * @param[in]  time
+    *
+    * @see allocatePatchDataOnDemand(const int, const double)
+    */
+   void
+   allocatePatchDataOnDemand(
+      const ComponentSelector& components,
+      const double time = 0.0);
+
+   /*!
+    * @brief Release the data of components allocated on demand that have
+    * not been used recently.
+    *
+    * The data object of a selected component allocated on demand is
+    * destroyed if getPatchData() has not been called for it since the
+    * previous call to this function, so a component survives one call
+    * after its last use.  The component stays allocated on demand, keeping
+    * its time, and a new data object is created when it is next used.
+    * Its previous values are lost, so this is only for data, such as
+    * scratch space, that are set before they are read.
+    *
+    * @return The size of the data released, in bytes.
+    *
+    * @param[in]  components
+    */
+   size_t
+   releaseIdlePatchData(
+      const ComponentSelector& components);
+
    /*!
     * @brief Deallocate the specified component.
     *
@@ -305,6 +413,9 @@ public:
    {
       TBOX_ASSERT((id >= 0) &&
          (id < getPatchDescriptor()->getMaxNumberRegisteredComponents()));
+      if (checkAllocatedOnDemand(id)) {
+         clearOnDemand(id);
+      }
       if (id < numPatchData()) {
          d_patch_data[id].reset();
       }
@@ -361,8 +472,12 @@ public:
       const int id)
    {
       TBOX_ASSERT((id >= 0) && (id < numPatchData()));
-      TBOX_ASSERT(d_patch_data[id]);
-      d_patch_data[id]->setTime(timestamp);
+      TBOX_ASSERT(checkAllocated(id));
+      if (d_patch_data[id]) {
+         d_patch_data[id]->setTime(timestamp);
+      } else {
+         d_on_demand_time[id] = timestamp;
+      }
    }
 
    /*!
@@ -413,16 +528,14 @@ public:
     *
     * When the index space of the level owning this patch aligns with the
     * index space of some valid hierarchy level, sets the patch level number
-    * The default level number is -1.
+    * The default level number is -1.  Memory of the patch data charged to
+    * tbox::MemoryUtilities accounts moves to the new level number.
     *
     * @param[in]  level_number
     */
    void
    setPatchLevelNumber(
-      const int level_number)
-   {
-      d_patch_level_number = level_number;
-   }
+      const int level_number);
    /*!
     * @brief Determine if the level holding this patch resides in a hierarchy.
     *
@@ -555,6 +668,37 @@ private:
    operator = (
       const Patch&);
 
+   /*
+    * Create the data object of a component allocated on demand if no
+    * other thread has created it, and return the data object.
+    */
+   std::shared_ptr<PatchData>
+   createOnDemandPatchData(
+      const int id) const;
+
+   /*
+    * Stop allocating a component on demand.
+    */
+   void
+   clearOnDemand(
+      const int id);
+
+   /*
+    * Charge the memory of a newly created data object to the account of
+    * the current tbox::MemoryUtilities::ChargeScope, or else to the
+    * account of its patch data index, if memory accounting is enabled.
+    */
+   void
+   chargePatchData(
+      const int id) const;
+
+   /*
+    * Credit the memory charged for a data object about to be released.
+    */
+   void
+   creditPatchData(
+      const int id) const;
+
    /*
     * The box defining the extent of this patch.
     */
@@ -564,7 +708,33 @@ private:
 
    std::shared_ptr<PatchGeometry> d_patch_geometry;
 
-   std::vector<std::shared_ptr<PatchData> > d_patch_data;
+   /*
+    * Mutable so that getPatchData() can create components allocated on
+    * demand.
+    */
+   mutable std::vector<std::shared_ptr<PatchData> > d_patch_data;
+
+   /*
+    * For each component, whether it is allocated on demand, whether it
+    * has been used since the last releaseIdlePatchData(), and the time
+    * to give its data object when it is created.  These are empty until
+    * a component is allocated on demand.
+    */
+   std::vector<char> d_on_demand;
+   mutable std::vector<char> d_on_demand_used;
+   std::vector<double> d_on_demand_time;
+
+   /*
+    * Memory charged to tbox::MemoryUtilities accounts for each component:
+    * the account (-1 if none), the level number charged and the size.
+    * This is empty until a component is charged.
+    */
+   struct ChargedMemory {
+      int d_account;
+      int d_level_number;
+      size_t d_bytes;
+   };
+   mutable std::vector<ChargedMemory> d_charged_memory;
 
    int d_patch_level_number;
 
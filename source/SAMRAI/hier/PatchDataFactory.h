@@ -177,6 +177,22 @@ public:
    validCopyTo(
       const std::shared_ptr<PatchDataFactory>& dst_pdf) const = 0;
 
+   /**
+    * @brief Return whether data of the supplied destination factory
+    * can unpack message streams packed by data of this factory.
+    *
+    * This is the case for most valid copies, which stream the same values
+    * on both sides.  A factory for which validCopyTo() is true but whose
+    * data converts values in copies, such as between the two floating
+    * point precisions, returns false; the communication schedules then
+    * pack a converted copy of the source data.  The default returns true.
+    *
+    * @pre validCopyTo(dst_pdf)
+    */
+   virtual bool
+   validStreamTo(
+      const std::shared_ptr<PatchDataFactory>& dst_pdf) const;
+
    virtual MultiblockDataTranslator *
    getMultiblockDataTranslator();
 
@@ -109,6 +109,22 @@ namespace hier {
  *      are willing to relax the minimum size constraints, set this parameter
  *      TRUE.
  *
+ *    - \b    use_slab_allocation
+ *      indicates whether the levels of the hierarchy allocate each patch data
+ *      component in one contiguous slab for all local patches instead of
+ *      separately on each patch.  See PatchLevel::setUseSlabAllocation().
+ *
+ *    - \b    use_first_touch_placement
+ *      indicates whether the levels of the hierarchy allocate the patch
+ *      data of each patch on the OpenMP thread that owns the patch, so
+ *      the data are placed in that thread's NUMA domain.  See
+ *      PatchLevel::setUseFirstTouchPlacement().
+ *
+ *    - \b    use_on_demand_allocation
+ *      indicates whether the levels of the hierarchy allocate patch data
+ *      on demand, creating each data object when it is first used.  See
+ *      PatchLevel::setUseOnDemandAllocation().
+ *
  * <b> Details: </b>
  * <table>
  *   <tr>
@@ -183,6 +199,30 @@ namespace hier {
  *     <td>opt</td>
  *     <td>Parameter read from restart db may be overridden by input db</td>
  *   </tr>
+ *   <tr>
+ *     <td>use_slab_allocation</td>
+ *     <td>bool</td>
+ *     <td>FALSE</td>
+ *     <td>TRUE, FALSE</td>
+ *     <td>opt</td>
+ *     <td>Not written to restart.  Value in input db used.</td>
+ *   </tr>
+ *   <tr>
+ *     <td>use_first_touch_placement</td>
+ *     <td>bool</td>
+ *     <td>FALSE</td>
+ *     <td>TRUE, FALSE</td>
+ *     <td>opt</td>
+ *     <td>Not written to restart.  Value in input db used.</td>
+ *   </tr>
+ *   <tr>
+ *     <td>use_on_demand_allocation</td>
+ *     <td>bool</td>
+ *     <td>FALSE</td>
+ *     <td>TRUE, FALSE</td>
+ *     <td>opt</td>
+ *     <td>Not written to restart.  Value in input db used.</td>
+ *   </tr>
  * </table>
  *
  * The following represents sample input data for a three-dimensional problem:
@@ -899,6 +939,34 @@ public:
       return (ln < getMaxNumberOfLevels() - 1) ? d_proper_nesting_buffer[ln] : -1;
    }
 
+   /*!
+    * @brief Get flag for allocating patch data in level-wide slabs.
+    */
+   bool
+   getUseSlabAllocation() const
+   {
+      return d_use_slab_allocation;
+   }
+
+   /*!
+    * @brief Get flag for allocating patch data on the threads owning
+    * the patches.
+    */
+   bool
+   getUseFirstTouchPlacement() const
+   {
+      return d_use_first_touch_placement;
+   }
+
+   /*!
+    * @brief Get flag for allocating patch data on demand.
+    */
+   bool
+   getUseOnDemandAllocation() const
+   {
+      return d_use_on_demand_allocation;
+   }
+
    /*!
     * @brief Get flag for allowing patches smaller than ghost width.
     */
@@ -1312,6 +1380,22 @@ private:
     */
    bool d_allow_patches_smaller_than_minimum_size_to_prevent_overlaps;
 
+   /*!
+    * @brief Whether levels allocate patch data in level-wide slabs.
+    */
+   bool d_use_slab_allocation;
+
+   /*!
+    * @brief Whether levels allocate patch data on the threads owning
+    * the patches.
+    */
+   bool d_use_first_touch_placement;
+
+   /*!
+    * @brief Whether levels allocate patch data on demand.
+    */
+   bool d_use_on_demand_allocation;
+
    /*!
     * @brief Required Connector width for self connectors.
     *
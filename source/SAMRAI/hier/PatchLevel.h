@@ -271,6 +271,156 @@ public:
       }
    }
 
+   /*!
+    * @brief Return whether patch data are allocated in level-wide slabs.
+    */
+   bool
+   getUseSlabAllocation() const
+   {
+      return d_use_slab_allocation;
+   }
+
+   /*!
+    * @brief Set whether patch data are allocated in level-wide slabs.
+    *
+    * In slab mode, allocatePatchData() makes one contiguous,
+    * tbox::MemorySlab::ALIGNMENT-aligned allocation per patch data
+    * component for all local patches, and the array data of each patch
+    * are carved out of it.  This replaces one allocation per component
+    * per patch with one per component per level.  The slab is released
+    * when the data of the last patch using it are deallocated, so
+    * deallocating the component on the level (or removing the level
+    * during regridding) frees it as a unit.
+    *
+    * @param[in]  use_slab_allocation  @b Default: false
+    */
+   void
+   setUseSlabAllocation(
+      bool use_slab_allocation)
+   {
+      d_use_slab_allocation = use_slab_allocation;
+   }
+
+   /*!
+    * @brief Return whether patch data are placed in the memory of the
+    * threads that own their patches.
+    */
+   bool
+   getUseFirstTouchPlacement() const
+   {
+      return d_use_first_touch_placement;
+   }
+
+   /*!
+    * @brief Set whether patch data are placed in the memory of the
+    * threads that own their patches.
+    *
+    * Operating systems place each page of memory on the NUMA domain of
+    * the thread that first writes it.  Normally allocatePatchData()
+    * allocates and initializes the data of all patches on the calling
+    * thread, which puts them all on one domain.  With first-touch
+    * placement, allocatePatchData() allocates in an OpenMP parallel
+    * region, each thread handling the patches getThreadPatchRange()
+    * assigns to it.  Threaded loops over patches that use the same
+    * assignment then work mostly on memory local to their thread.
+    *
+    * This has no effect without OpenMP.  Slab allocation takes
+    * precedence over it.
+    *
+    * @param[in]  use_first_touch_placement  @b Default: false
+    *
+    * @see tbox::MemoryPool::setFirstTouch()
+    */
+   void
+   setUseFirstTouchPlacement(
+      bool use_first_touch_placement)
+   {
+      d_use_first_touch_placement = use_first_touch_placement;
+   }
+
+   /*!
+    * @brief Return whether patch data are allocated on demand.
+    */
+   bool
+   getUseOnDemandAllocation() const
+   {
+      return d_use_on_demand_allocation;
+   }
+
+   /*!
+    * @brief Set whether patch data are allocated on demand.
+    *
+    * With on-demand allocation, allocatePatchData() only records on
+    * each patch that the components are allocated, and a data object is
+    * created when Patch::getPatchData() is first called for it, by the
+    * application or by a communication transaction.  Components that are
+    * registered for every level but used on only some of them, or only
+    * at some steps, then take no memory where they are not used, and
+    * releaseIdlePatchData() can free those that have fallen out of use.
+    * The memory saved is reported by tbox::MemoryUtilities.
+    *
+    * On-demand allocation takes precedence over slab allocation and
+    * first-touch placement.
+    *
+    * @param[in]  use_on_demand_allocation  @b Default: false
+    *
+    * @see Patch::allocatePatchDataOnDemand()
+    */
+   void
+   setUseOnDemandAllocation(
+      bool use_on_demand_allocation)
+   {
+      d_use_on_demand_allocation = use_on_demand_allocation;
+   }
+
+   /*!
+    * @brief Get the range of local patches a thread owns under the
+    * static patch-to-thread mapping.
+    *
+    * The local patches, indexed as by getPatch(size_t), are split into
+    * num_threads contiguous ranges of nearly equal size, and thread t
+    * owns the t-th range.  The mapping depends only on the number of
+    * local patches and of threads, so loops using it give each thread
+    * the same patches every time.  Threaded loops over patches should
+    * use it, with the team size and thread number, instead of relying
+    * on the schedule of an omp for loop.
+    *
+    * @param[in]  thread Thread number
+    * @param[in]  num_threads Number of threads in the team
+    * @param[out] begin Index of the first patch owned by the thread
+    * @param[out] end One past the index of the last patch owned by the
+    *             thread
+    *
+    * @pre (thread >= 0) && (thread < num_threads)
+    */
+   void
+   getThreadPatchRange(
+      int thread,
+      int num_threads,
+      int& begin,
+      int& end) const
+   {
+      TBOX_ASSERT(thread >= 0 && thread < num_threads);
+      const long num_patches = static_cast<long>(d_patch_vector.size());
+      begin = static_cast<int>(num_patches * thread / num_threads);
+      end = static_cast<int>(num_patches * (thread + 1) / num_threads);
+   }
+
+   /*!
+    * @brief Return the thread owning a local patch under the mapping
+    * of getThreadPatchRange().
+    *
+    * @param[in]  index Index of the patch, as for getPatch(size_t)
+    * @param[in]  num_threads Number of threads in the team
+    *
+    * @pre index < getLocalNumberOfPatches()
+    * @pre num_threads > 0
+    */
+   int
+   getPatchThread(
+      size_t index,
+      int num_threads) const;
+
    /*!
     * @brief Get the number of patches.
     *
@@ -749,14 +899,30 @@ public:
     *
     * @param[in]  id
     * @param[in]  timestamp @b Default: zero (0.0)
+    *
+    * @see setUseSlabAllocation()
+    * @see setUseFirstTouchPlacement()
+    * @see setUseOnDemandAllocation()
     */
    void
    allocatePatchData(
       const int id,
       const double timestamp = 0.0)
    {
-      for (Iterator ip(begin()); ip != end(); ++ip) {
-         ip->allocatePatchData(id, timestamp);
+      if (d_use_on_demand_allocation) {
+         for (Iterator ip(begin()); ip != end(); ++ip) {
+            ip->allocatePatchDataOnDemand(id, timestamp);
+         }
+      } else if (d_use_slab_allocation) {
+         allocatePatchDataInSlab(id, timestamp);
+      } else if (d_use_first_touch_placement) {
+         ComponentSelector components;
+         components.setFlag(id);
+         allocatePatchDataByThread(components, timestamp);
+      } else {
+         for (Iterator ip(begin()); ip != end(); ++ip) {
+            ip->allocatePatchData(id, timestamp);
+         }
       }
    }
 
@@ -772,8 +938,23 @@ public:
       const ComponentSelector& components,
       const double timestamp = 0.0)
    {
-      for (Iterator ip(begin()); ip != end(); ++ip) {
-         ip->allocatePatchData(components, timestamp);
+      if (d_use_on_demand_allocation) {
+         for (Iterator ip(begin()); ip != end(); ++ip) {
+            ip->allocatePatchDataOnDemand(components, timestamp);
+         }
+      } else if (d_use_slab_allocation) {
+         const int ncomponents = d_descriptor->getMaxNumberRegisteredComponents();
+         for (int id = 0; id < ncomponents; ++id) {
+            if (components.isSet(id)) {
+               allocatePatchDataInSlab(id, timestamp);
+            }
+         }
+      } else if (d_use_first_touch_placement) {
+         allocatePatchDataByThread(components, timestamp);
+      } else {
+         for (Iterator ip(begin()); ip != end(); ++ip) {
+            ip->allocatePatchData(components, timestamp);
+         }
       }
    }
 
@@ -831,6 +1012,28 @@ public:
       }
    }
 
+   /*!
+    * @brief Release the data of components allocated on demand that
+    * have not been used recently, on all patches.
+    *
+    * @return The size of the data released, in bytes.
+    *
+    * @param[in]  components The ComponentSelector indicating which
+    *             components may be released.
+    *
+    * @see Patch::releaseIdlePatchData()
+    */
+   size_t
+   releaseIdlePatchData(
+      const ComponentSelector& components)
+   {
+      size_t released = 0;
+      for (Iterator ip(begin()); ip != end(); ++ip) {
+         released += ip->releaseIdlePatchData(components);
+      }
+      return released;
+   }
+
    /*!
     * @brief Get the dimension of this object.
     *
@@ -1296,6 +1499,24 @@ private:
    void
    initializeGlobalizedBoxLevel() const;
 
+   /*!
+    * @brief Allocate a component on all local patches, carving the
+    * array data from a single tbox::MemorySlab.
+    */
+   void
+   allocatePatchDataInSlab(
+      const int id,
+      const double timestamp);
+
+   /*!
+    * @brief Allocate components on all local patches, each patch on
+    * the thread that owns it.
+    */
+   void
+   allocatePatchDataByThread(
+      const ComponentSelector& components,
+      const double timestamp);
+
    /*!
     * @brief Dimension of the object
     */
@@ -1384,6 +1605,21 @@ private:
     */
    bool d_in_hierarchy;
 
+   /*
+    * Whether patch data are allocated in level-wide slabs.
+    */
+   bool d_use_slab_allocation;
+
+   /*
+    * Whether patch data are allocated by the threads owning the patches.
+    */
+   bool d_use_first_touch_placement;
+
+   /*
+    * Whether patch data are allocated on demand.
+    */
+   bool d_use_on_demand_allocation;
+
    /*
     * Container for patches.
     */
@@ -12,7 +12,11 @@
 
 #include "SAMRAI/SAMRAI_config.h"
 #include "SAMRAI/hier/IntVector.h"
+#include "SAMRAI/tbox/SAMRAI_MPI.h"
 
+#include <iostream>
+#include <map>
+#include <memory>
 #include <vector>
 
 namespace SAMRAI {
@@ -32,6 +36,7 @@ enum ConnectorNotFoundAction {
 
 class Connector;
 class BoxLevel;
+class BoxLevelHandle;
 
 /*!
  * @brief A managager of overlap Connectors incident from a
@@ -46,7 +51,25 @@ class BoxLevel;
  *
  * For improved scalability, Connectors can be constructed externally
  * and copied into the collection.  Connectors can also be
- * automatically computed using a non-scalable global search.
+ * automatically computed, by default with a non-scalable global
+ * search, or optionally with the assumed partition rendezvous algorithm
+ * (see OverlapConnectorAlgorithm::findOverlaps_assumedPartition()),
+ * which does not globalize either BoxLevel.
+ *
+ * All cached Connectors, over all BoxLevels, may be held to a memory
+ * budget (see input parameter memory_budget and setMemoryBudget()).
+ * Eviction only happens in evictToMemoryBudget(), a collective call the
+ * application makes at a point where it holds no references returned by
+ * findConnector() other than through shareConnector().  When the
+ * estimated memory of the cached Connectors exceeds the budget the least
+ * recently used unpinned Connectors are evicted.  Connectors cached with
+ * cacheConnector() are pinned because they cannot be recomputed
+ * scalably.  Connectors created by a search or extracted from a wider
+ * Connector are not pinned.  Connectors shared with shareConnector(), and
+ * their transposes, are never evicted while shared.  An evicted
+ * Connector is recomputed when next needed, even if the not-found action
+ * is to fail, so eviction is invisible to findConnector() callers except
+ * for the cost of recomputing.
  *
  * <b> Input Parameters </b>
  *
@@ -55,9 +78,23 @@ class BoxLevel;
  *    - \b implicit_connector_creation_rule
  *      How to proceed when findConnector() cannot find any suitable overlap
  *      Connector.  Values can be "ERROR", "WARN" (default) or "SILENT".  If
- *      "SILENT", silently get a globalized version of the head BoxLevel and
- *      look for overlaps.  If "WARN", do the same thing but write a warning to
- *      the log.  If "ERROR", exit with an error.
+ *      "SILENT", silently search for overlaps as specified by
+ *      implicit_connector_search.  If "WARN", do the same thing but write a
+ *      warning to the log.  If "ERROR", exit with an error.
+ *
+ *    - \b implicit_connector_search
+ *      How Connectors are computed when they must be created.  Values can
+ *      be "GLOBAL" (default) or "ASSUMED_PARTITION".  "ASSUMED_PARTITION"
+ *      registers the boxes of both BoxLevels with the processes owning
+ *      their regions of an assumed partition and finds overlaps there.
+ *      "GLOBAL" gets a globalized version of the head BoxLevel, which
+ *      needs memory proportional to the global number of boxes on every
+ *      process.
+ *
+ *    - \b memory_budget
+ *      Memory budget, in megabytes, for the Connectors cached by all
+ *      PersistentOverlapConnectors objects.  Zero or negative means no
+ *      budget.
  *
  * <b> Details: </b> <br>
  * <table>
@@ -77,9 +114,26 @@ class BoxLevel;
  *     <td>opt</td>
  *     <td>Not read from restart</td>
  *   </tr>
+ *   <tr>
+ *     <td>implicit_connector_search</td>
+ *     <td>string</td>
+ *     <td>"GLOBAL"</td>
+ *     <td>"GLOBAL", "ASSUMED_PARTITION"</td>
+ *     <td>opt</td>
+ *     <td>Not read from restart</td>
+ *   </tr>
+ *   <tr>
+ *     <td>memory_budget</td>
+ *     <td>double</td>
+ *     <td>0.0 (no budget)</td>
+ *     <td>any double</td>
+ *     <td>opt</td>
+ *     <td>Not read from restart</td>
+ *   </tr>
  * </table>
  *
- * @note Creating overlap Connectors by global search is not scalable
+ * @note Creating overlap Connectors by search is less scalable than bridging,
+ * and a global search is not scalable at all.
  * Nevertheless, the default for implicit_connector_creation_rule is "WARN",
  * so that application development need not worry about missing overlap
  * Connectors.  To selectively enable automatic Connector generation, set this
@@ -106,6 +160,93 @@ public:
    setCreateEmptyNeighborContainers(
       bool create_empty_neighbor_containers);
 
+   /*!
+    * @brief Set the memory budget, in bytes, for the Connectors cached
+    * by all PersistentOverlapConnectors objects.
+    *
+    * Zero means no budget.  This overrides the memory_budget input
+    * parameter.  The budget is enforced by evictToMemoryBudget().
+    */
+   static void
+   setMemoryBudget(
+      size_t memory_budget);
+
+   /*!
+    * @brief Returns the memory budget in bytes, zero if there is none.
+    */
+   static size_t
+   getMemoryBudget()
+   {
+      return s_memory_budget;
+   }
+
+   /*!
+    * @brief Returns the estimated number of bytes used by all cached
+    * Connectors.
+    */
+   static size_t
+   getCachedMemory()
+   {
+      return s_cached_memory;
+   }
+
+   /*!
+    * @brief Returns the number of Connectors evicted to stay within the
+    * memory budget.
+    */
+   static size_t
+   getNumberOfEvictions()
+   {
+      return s_num_evictions;
+   }
+
+   /*!
+    * @brief Evict least recently used Connectors until the cached
+    * Connectors are within the memory budget.
+    *
+    * This is collective over mpi, which must include every process
+    * holding the cached Connectors.  The memory, recency of use and
+    * pinning of each Connector are reduced over the processes, so all
+    * processes evict the same Connectors.  Pinned Connectors and those
+    * shared with shareConnector() are never evicted.
+    *
+    * References to evicted Connectors returned by findConnector() and
+    * related methods become invalid, so call this only where the caller
+    * holds no such references, for example between time steps.
+    *
+    * @param[in] mpi
+    */
+   static void
+   evictToMemoryBudget(
+      const tbox::SAMRAI_MPI& mpi);
+
+   /*!
+    * @brief Returns a pointer sharing ownership of a cached Connector.
+    *
+    * A Connector shared this way, and its transpose, is not evicted by
+    * evictToMemoryBudget() and stays valid while the pointer is held,
+    * even if its BoxLevels later drop it.
+    *
+    * @param[in] connector A Connector returned by findConnector() or a
+    * related method.
+    *
+    * @return The shared pointer, or an unset pointer if connector is not
+    * cached.
+    */
+   static std::shared_ptr<const Connector>
+   shareConnector(
+      const Connector& connector);
+
+   /*!
+    * @brief Print cache statistics: hits, misses, evictions and
+    * recomputations of evicted Connectors.
+    *
+    * @param[in,out] os The output stream
+    */
+   static void
+   printStatistics(
+      std::ostream& os);
+
 private:
    /*!
     * @brief Deletes all Connectors to and from this object
@@ -113,11 +254,11 @@ private:
    ~PersistentOverlapConnectors();
 
    /*!
-    * @brief Create an overlap Connector, computing relationships by
-    * globalizing data.
+    * @brief Create an overlap Connector, computing relationships with
+    * the search specified by the implicit_connector_search input
+    * parameter.
     *
     * The base will be the BoxLevel that owns this object.
-    * Find Connector relationships using a (non-scalable) global search.
     *
     * @see Connector
     * @see Connector::initialize()
@@ -137,10 +278,10 @@ private:
 
    /*!
     * @brief Create an overlap Connector with its transpose, computing
-    * relationships by globalizing data.
+    * relationships with the search specified by the
+    * implicit_connector_search input parameter.
     *
     * The base will be the BoxLevel that owns this object.
-    * Find Connector relationships using a (non-scalable) global search.
     *
     * @see Connector
     * @see Connector::initialize()
@@ -186,12 +327,12 @@ private:
     * @par Assertions
     * If no Connector fits the criteria and not_found_action == ERROR, an
     * unrecoverable error will be generated.  If not_found_action == CREATE,
-    * the Connector will be generated using an unscalable algorithm.  If
+    * the Connector will be generated using createConnector().  If
     * not_found_action == IMPLICIT_CREATION_RULE, the behavior will be
     * determined by the @c implicit_connector_creation_rule input parameter.
     * If it is "ERROR", an unrecoverable error will be generated.  If it is
-    * "WARN" or "SILENT" the Connector will be generated using an unscalable
-    * algorithm and either a warning will be generated or not.
+    * "WARN" or "SILENT" the Connector will be generated using
+    * createConnector() and either a warning will be generated or not.
     *
     * @param[in] head Find the overlap Connector with this specified head.
     * @param[in] min_connector_width Find the overlap Connector satisfying
@@ -229,12 +370,12 @@ private:
     * @par Assertions
     * If no Connector fits the criteria and not_found_action == ERROR, an
     * unrecoverable error will be generated.  If not_found_action == CREATE,
-    * the Connector will be generated using an unscalable algorithm.  If
+    * the Connector will be generated using createConnector().  If
     * not_found_action == IMPLICIT_CREATION_RULE, the behavior will be
     * determined by the @c implicit_connector_creation_rule input parameter.
     * If it is "ERROR", an unrecoverable error will be generated.  If it is
-    * "WARN" or "SILENT" the Connector will be generated using an unscalable
-    * algorithm and either a warning will be generated or not.
+    * "WARN" or "SILENT" the Connector will be generated using
+    * createConnector() and either a warning will be generated or not.
     *
     * @param[in] head Find the overlap Connector with this specified head.
     * @param[in] min_connector_width Find the overlap Connector satisfying
@@ -336,12 +477,91 @@ private:
    /*
     * @brief Make sure all base boxes have a neighbor set or remove
     * empty neighbor sets, depending on
-    * s_create_empty_neighbor_containers.
+    * s_create_empty_neighbor_containers, then compress the neighborhoods.
     */
    void
    postprocessForEmptyNeighborContainers(
       Connector& connector);
 
+   /*
+    * @brief Add a Connector from me to the persistent Connectors of both
+    * ends and account for its memory.
+    *
+    * @param[in] head
+    * @param[in] connector
+    * @param[in] pinned Whether the Connector must never be evicted.
+    */
+   void
+   addConnector(
+      const BoxLevel& head,
+      const std::shared_ptr<Connector>& connector,
+      bool pinned);
+
+   /*
+    * @brief Drop the accounting for a Connector being deleted.
+    */
+   static void
+   forgetConnector(
+      const Connector* connector);
+
+   /*
+    * @brief Return the number of the tbox::MemoryUtilities account of
+    * cached Connectors.
+    */
+   static int
+   getConnectorMemoryAccount();
+
+   /*
+    * @brief Mark a cached Connector as used by the current operation.
+    */
+   static void
+   touchConnector(
+      const Connector* connector);
+
+   /*
+    * @brief Start an operation that may add Connectors.
+    *
+    * Operations nest.  All Connectors used by the outermost operation get
+    * the same recency of use.
+    */
+   static void
+   beginOperation();
+
+   /*
+    * @brief End an operation started by beginOperation().
+    */
+   static void
+   endOperation();
+
+   /*
+    * @brief Whether a Connector from me, or a Connector whose transpose
+    * it is, is referenced outside the cache.
+    */
+   bool
+   isSharedOutside(
+      const Connector* connector) const;
+
+   /*
+    * @brief Remove a Connector from me and remember how to recompute it.
+    *
+    * @pre connector is in d_cons_from_me
+    */
+   void
+   evictConnector(
+      const Connector* connector);
+
+   /*
+    * @brief Recompute an evicted Connector with the given head whose
+    * width is at least min_width, if there is one.
+    *
+    * @return The recomputed Connector, or an unset pointer if no evicted
+    * Connector matches.
+    */
+   std::shared_ptr<Connector>
+   recomputeEvictedConnector(
+      const BoxLevel& head,
+      const IntVector& min_width);
+
    //@}
 
    //@{
@@ -354,6 +574,51 @@ private:
 
    typedef std::vector<std::shared_ptr<Connector> > ConVect;
 
+   /*
+    * @brief Memory accounting and recency of use of a cached Connector.
+    */
+   struct CacheEntry {
+      // The PersistentOverlapConnectors of the Connector's base.
+      PersistentOverlapConnectors* d_owner;
+      // Estimated footprint on this process.
+      size_t d_memory;
+      // Value of s_use_count when the Connector was last used.
+      unsigned long int d_last_use;
+      // Order of addition, to break ties in d_last_use the same way on
+      // all processes.
+      unsigned long int d_sequence;
+      // Local footprint charged to the "Connector" memory account of
+      // tbox::MemoryUtilities, 0 if memory accounting was off.
+      size_t d_charged_memory;
+      // Whether the Connector must never be evicted.
+      bool d_pinned;
+   };
+
+   typedef std::map<const Connector *, CacheEntry> CacheEntryMap;
+
+   /*
+    * @brief Order cache entries by their sequence of addition.
+    */
+   static bool
+   compareSequence(
+      const CacheEntryMap::const_iterator& a,
+      const CacheEntryMap::const_iterator& b);
+
+   /*
+    * @brief Record of an evicted Connector, enough to recompute it.
+    */
+   struct EvictedConnector {
+      EvictedConnector(
+         const std::shared_ptr<BoxLevelHandle>& head_handle,
+         const IntVector& width):
+         d_head_handle(head_handle),
+         d_width(width) {
+      }
+      // Handle of the head, detached if the head has changed.
+      std::shared_ptr<BoxLevelHandle> d_head_handle;
+      IntVector d_width;
+   };
+
    /*!
     * @brief Persistent overlap Connectors incident from me.
     */
@@ -364,6 +629,11 @@ private:
     */
    ConVect d_cons_to_me;
 
+   /*!
+    * @brief Connectors from me that were evicted and can be recomputed.
+    */
+   std::vector<EvictedConnector> d_evicted;
+
    /*!
     * @brief Reference to the BoxLevel served by this object.
     */
@@ -393,11 +663,66 @@ private:
     */
    static char s_implicit_connector_creation_rule;
 
+   /*!
+    * @brief How to search for overlaps when creating Connectors: 'a' for
+    * the assumed partition algorithm or 'g' for a global search.
+    *
+    * See input parameter implicit_connector_search.
+    */
+   static char s_implicit_connector_search;
+
    /*
-    * @brief Count of how many times we have done implicit global searches.
+    * @brief Count of how many times we have done implicit searches.
     */
    static size_t s_num_implicit_global_searches;
 
+   /*!
+    * @brief Accounting for every cached Connector of every
+    * PersistentOverlapConnectors.
+    */
+   static CacheEntryMap s_cache_entries;
+
+   /*!
+    * @brief Memory budget in bytes for all cached Connectors.  Zero
+    * means no budget.
+    */
+   static size_t s_memory_budget;
+
+   /*!
+    * @brief Estimated memory in bytes of all cached Connectors.
+    */
+   static size_t s_cached_memory;
+
+   /*!
+    * @brief Counter advanced by each outermost operation, used as the
+    * recency of use of cached Connectors.
+    */
+   static unsigned long int s_use_count;
+
+   /*!
+    * @brief Counter of Connectors added, used as their sequence number.
+    */
+   static unsigned long int s_add_count;
+
+   /*!
+    * @brief Nesting depth of operations (see beginOperation()).
+    */
+   static int s_operation_depth;
+
+   //@{
+   //! @name Cache statistics.
+   static size_t s_num_hits;
+   static size_t s_num_misses;
+   static size_t s_num_evictions;
+   static size_t s_num_recomputations;
+   static size_t s_max_cached_memory;
+   //@}
+
+   /*
+    * @brief Memory account of cached Connectors, -1 until first used.
+    */
+   static int s_connector_memory_account;
+
 };
 
 }
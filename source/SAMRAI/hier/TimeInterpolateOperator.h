@@ -16,6 +16,7 @@
 #include "SAMRAI/hier/Box.h"
 #include "SAMRAI/hier/PatchData.h"
 #include "SAMRAI/hier/Variable.h"
+#include "SAMRAI/tbox/MessageStream.h"
 
 #include <string>
 #include <memory>
@@ -94,6 +95,59 @@ public:
       const PatchData& src_data_old,
       const PatchData& src_data_new) const = 0;
 
+   /**
+    * Return true if the operator can time interpolate over the given
+    * overlap straight into destination data or a message stream, with
+    * timeInterpolateAndCopy() and timeInterpolateAndPack().  Operators
+    * that can skip the temporary patch data otherwise needed between
+    * interpolating and copying should override this.  The default
+    * returns false.
+    */
+   virtual bool
+   canTimeInterpolateOverlap(
+      const BoxOverlap& overlap) const;
+
+   /**
+    * Time interpolate between two patch data sources to the given time
+    * and place the result in the destination patch data over the
+    * overlap, as copying from source patch data holding the interpolated
+    * values would.  Called only when canTimeInterpolateOverlap() returns
+    * true for the overlap.  The default is an unrecoverable error.
+    */
+   virtual void
+   timeInterpolateAndCopy(
+      PatchData& dst_data,
+      const BoxOverlap& overlap,
+      const PatchData& src_data_old,
+      const PatchData& src_data_new,
+      double time) const;
+
+   /**
+    * Time interpolate between two patch data sources to the given time
+    * and pack the result over the overlap into the stream, as packing
+    * source patch data holding the interpolated values would.  Called
+    * only when canTimeInterpolateOverlap() returns true for the overlap.
+    * The default is an unrecoverable error.
+    */
+   virtual void
+   timeInterpolateAndPack(
+      tbox::MessageStream& stream,
+      const BoxOverlap& overlap,
+      const PatchData& src_data_old,
+      const PatchData& src_data_new,
+      double time) const;
+
+protected:
+   /**
+    * Return the fraction of the interval from old_time to new_time at
+    * which time lies, or zero if the interval is empty.
+    */
+   static double
+   getTimeFraction(
+      double old_time,
+      double new_time,
+      double time);
+
 private:
    // Neither of these is implemented.
    TimeInterpolateOperator(
@@ -15,6 +15,7 @@
 #include "SAMRAI/tbox/Complex.h"
 #include "SAMRAI/hier/Box.h"
 #include "SAMRAI/pdat/ArrayData.h"
+#include "SAMRAI/pdat/ArrayDataBatch.h"
 
 namespace SAMRAI {
 namespace math {
@@ -41,7 +42,12 @@ namespace math {
  * may not make sense), the member functions must be specialized so that the
  * correct operations are performed.
  *
+ * The elementwise operations are also provided for pdat::ArrayDataBatch
+ * arguments, which apply them to the array data of many patches in one
+ * threaded loop.  The batches given to one of these must be aligned.
+ *
  * @see pdat::ArrayData
+ * @see pdat::ArrayDataBatch
  */
 
 template<class TYPE>
@@ -249,6 +255,110 @@ public:
       const TYPE& low,
       const hier::Box& box) const;
 
+   /**
+    * Set dst = alpha, elementwise, on every entry of a batch.
+    */
+   void
+   setToScalar(
+      const pdat::ArrayDataBatch<TYPE>& dst,
+      const TYPE& alpha) const;
+
+   /**
+    * Set dst = src, elementwise, on every entry of aligned batches.
+    *
+    * @pre dst.isAlignedWith(src)
+    */
+   void
+   copy(
+      const pdat::ArrayDataBatch<TYPE>& dst,
+      const pdat::ArrayDataBatch<TYPE>& src) const;
+
+   /**
+    * Set dst = alpha * src, elementwise, on every entry of aligned
+    * batches.
+    *
+    * @pre dst.isAlignedWith(src)
+    */
+   void
+   scale(
+      const pdat::ArrayDataBatch<TYPE>& dst,
+      const TYPE& alpha,
+      const pdat::ArrayDataBatch<TYPE>& src) const;
+
+   /**
+    * Set dst = src + alpha, elementwise, on every entry of aligned
+    * batches.
+    *
+    * @pre dst.isAlignedWith(src)
+    */
+   void
+   addScalar(
+      const pdat::ArrayDataBatch<TYPE>& dst,
+      const pdat::ArrayDataBatch<TYPE>& src,
+      const TYPE& alpha) const;
+
+   /**
+    * Set dst = src1 + src2, elementwise, on every entry of aligned
+    * batches.
+    *
+    * @pre dst.isAlignedWith(src1) && dst.isAlignedWith(src2)
+    */
+   void
+   add(
+      const pdat::ArrayDataBatch<TYPE>& dst,
+      const pdat::ArrayDataBatch<TYPE>& src1,
+      const pdat::ArrayDataBatch<TYPE>& src2) const;
+
+   /**
+    * Set dst = src1 - src2, elementwise, on every entry of aligned
+    * batches.
+    *
+    * @pre dst.isAlignedWith(src1) && dst.isAlignedWith(src2)
+    */
+   void
+   subtract(
+      const pdat::ArrayDataBatch<TYPE>& dst,
+      const pdat::ArrayDataBatch<TYPE>& src1,
+      const pdat::ArrayDataBatch<TYPE>& src2) const;
+
+   /**
+    * Set dst = src1 * src2, elementwise, on every entry of aligned
+    * batches.
+    *
+    * @pre dst.isAlignedWith(src1) && dst.isAlignedWith(src2)
+    */
+   void
+   multiply(
+      const pdat::ArrayDataBatch<TYPE>& dst,
+      const pdat::ArrayDataBatch<TYPE>& src1,
+      const pdat::ArrayDataBatch<TYPE>& src2) const;
+
+   /**
+    * Set dst = alpha * src1 + src2, elementwise, on every entry of
+    * aligned batches.
+    *
+    * @pre dst.isAlignedWith(src1) && dst.isAlignedWith(src2)
+    */
+   void
+   axpy(
+      const pdat::ArrayDataBatch<TYPE>& dst,
+      const TYPE& alpha,
+      const pdat::ArrayDataBatch<TYPE>& src1,
+      const pdat::ArrayDataBatch<TYPE>& src2) const;
+
+   /**
+    * Set dst = alpha * src1 - src2, elementwise, on every entry of
+    * aligned batches.
+    *
+    * @pre dst.isAlignedWith(src1) && dst.isAlignedWith(src2)
+    */
+   void
+   axmy(
+      const pdat::ArrayDataBatch<TYPE>& dst,
+      const TYPE& alpha,
+      const pdat::ArrayDataBatch<TYPE>& src1,
+      const pdat::ArrayDataBatch<TYPE>& src2) const;
+
 private:
    // The following are not implemented:
    ArrayDataBasicOps(
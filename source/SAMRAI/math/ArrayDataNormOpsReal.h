@@ -41,6 +41,11 @@ namespace math {
  * the template parameter. A similar set of norm operations is implemented
  * for complex array data in the class ArrayDataNormOpsComplex.
  *
+ * All sums, including the dot products and integrals, are accumulated
+ * and returned in double precision, so that the results for float data,
+ * which is often used to halve the storage of auxiliary fields, do not
+ * lose accuracy as the number of entries grows.
+ *
  * @see pdat::ArrayData
  */
 
@@ -194,7 +199,7 @@ public:
     *      (data1.getDim() == box.getDim())
     * @pre data1.getDepth == data2.getDepth()
     */
-   TYPE
+   double
    dotWithControlVolume(
       const pdat::ArrayData<TYPE>& data1,
       const pdat::ArrayData<TYPE>& data2,
@@ -209,7 +214,7 @@ public:
     *      (data1.getDim() == box.getDim())
     * @pre data1.getDepth == data2.getDepth()
     */
-   TYPE
+   double
    dot(
       const pdat::ArrayData<TYPE>& data1,
       const pdat::ArrayData<TYPE>& data2,
@@ -221,7 +226,7 @@ public:
     *
     * @pre (data.getDim() == vol.getDim()) && (data.getDim() == box.getDim())
     */
-   TYPE
+   double
    integral(
       const pdat::ArrayData<TYPE>& data,
       const pdat::ArrayData<double>& vol,
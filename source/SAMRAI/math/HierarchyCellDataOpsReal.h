@@ -33,7 +33,9 @@ namespace math {
  * data objects where the data is either double or float. The operations
  * include basic arithmetic, norms and ordering, and assorted miscellaneous
  * operations.  On each patch, the operations are performed by the
- * PatchCellDataOpsReal data member.
+ * PatchCellDataOpsReal data member.  The copy, set and elementwise
+ * arithmetic operations are done for all patches of a level at once,
+ * in a single threaded loop over a pdat::ArrayDataBatch.
  *
  * The patch hierarchy and set of levels within that hierarcy over which the
  * operations will be performed are set in the constructor.  However, note
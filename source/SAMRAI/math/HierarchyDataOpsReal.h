@@ -378,7 +378,8 @@ public:
     * return value is the sum \f$\sum_i ( data1_i * data2_i * cvol_i )\f$.
     * If the control volume is undefined (vol_id < 0), it is ignored during
     * the summation.  If local_only is true, the global reduction is not
-    * performed (thus each process will get only local results).
+    * performed (thus each process will get only local results).  The sum
+    * is accumulated in double precision, also for float data.
     */
    virtual TYPE
    dot(
@@ -16,6 +16,8 @@
 #include "SAMRAI/pdat/CellData.h"
 #include "SAMRAI/math/ArrayDataBasicOps.h"
 #include "SAMRAI/hier/Box.h"
+#include "SAMRAI/hier/PatchLevel.h"
+#include "SAMRAI/pdat/ArrayDataBatch.h"
 #include "SAMRAI/tbox/Complex.h"
 
 #include <memory>
@@ -42,7 +44,14 @@ namespace math {
  * types as the template parameter.  None of the operations are implemented
  * for any other type.
  *
+ * The elementwise arithmetic operations are also provided for all local
+ * patches of a level at once.  These gather the array data of every
+ * patch into a pdat::ArrayDataBatch and run one threaded loop over all
+ * of it, which is much faster than a loop over patches when the
+ * patches are small.
+ *
  * @see ArrayDataBasicOps
+ * @see pdat::ArrayDataBatch
  */
 
 template<class TYPE>
@@ -235,6 +244,134 @@ public:
       const TYPE& low,
       const hier::Box& box) const;
 
+   /**
+    * Set dst = alpha * src, elementwise, on all local patches of a
+    * level.
+    *
+    * @param[in] level
+    * @param[in] dst_id
+    * @param[in] alpha
+    * @param[in] src_id
+    * @param[in] interior_only  If true, operate on the patch boxes,
+    *                           else on the ghost boxes of dst.
+    */
+   void
+   scale(
+      const hier::PatchLevel& level,
+      const int dst_id,
+      const TYPE& alpha,
+      const int src_id,
+      const bool interior_only) const;
+
+   /**
+    * Set dst = src + alpha, elementwise, on all local patches of a
+    * level.
+    *
+    * @see scale(const hier::PatchLevel&, const int, const TYPE&, const int, const bool) const
+    */
+   void
+   addScalar(
+      const hier::PatchLevel& level,
+      const int dst_id,
+      const int src_id,
+      const TYPE& alpha,
+      const bool interior_only) const;
+
+   /**
+    * Set dst = src1 + src2, elementwise, on all local patches of a
+    * level.
+    *
+    * @see scale(const hier::PatchLevel&, const int, const TYPE&, const int, const bool) const
+    */
+   void
+   add(
+      const hier::PatchLevel& level,
+      const int dst_id,
+      const int src1_id,
+      const int src2_id,
+      const bool interior_only) const;
+
+   /**
+    * Set dst = src1 - src2, elementwise, on all local patches of a
+    * level.
+    *
+    * @see scale(const hier::PatchLevel&, const int, const TYPE&, const int, const bool) const
+    */
+   void
+   subtract(
+      const hier::PatchLevel& level,
+      const int dst_id,
+      const int src1_id,
+      const int src2_id,
+      const bool interior_only) const;
+
+   /**
+    * Set dst = src1 * src2, elementwise, on all local patches of a
+    * level.
+    *
+    * @see scale(const hier::PatchLevel&, const int, const TYPE&, const int, const bool) const
+    */
+   void
+   multiply(
+      const hier::PatchLevel& level,
+      const int dst_id,
+      const int src1_id,
+      const int src2_id,
+      const bool interior_only) const;
+
+   /**
+    * Set dst = alpha * src1 + src2, elementwise, on all local patches
+    * of a level.
+    *
+    * @see scale(const hier::PatchLevel&, const int, const TYPE&, const int, const bool) const
+    */
+   void
+   axpy(
+      const hier::PatchLevel& level,
+      const int dst_id,
+      const TYPE& alpha,
+      const int src1_id,
+      const int src2_id,
+      const bool interior_only) const;
+
+   /**
+    * Set dst = alpha * src1 - src2, elementwise, on all local patches
+    * of a level.
+    *
+    * @see scale(const hier::PatchLevel&, const int, const TYPE&, const int, const bool) const
+    */
+   void
+   axmy(
+      const hier::PatchLevel& level,
+      const int dst_id,
+      const TYPE& alpha,
+      const int src1_id,
+      const int src2_id,
+      const bool interior_only) const;
+
+protected:
+   /**
+    * Gather the cell data of up to three patch data ids on the local
+    * patches of a level into aligned batches.  On each patch, the box
+    * is the patch box if interior_only is true, or else the ghost box
+    * of the dst data, intersected with the ghost boxes of all the
+    * sources.  src1 and src2 may be null.
+    *
+    * @pre each id refers to pdat::CellData<TYPE> on every patch
+    */
+   static void
+   gatherLevelBatches(
+      const hier::PatchLevel& level,
+      const bool interior_only,
+      const int dst_id,
+      pdat::ArrayDataBatch<TYPE>& dst,
+      const int src1_id,
+      pdat::ArrayDataBatch<TYPE>* src1,
+      const int src2_id,
+      pdat::ArrayDataBatch<TYPE>* src2);
+
+   ArrayDataBasicOps<TYPE> d_array_ops;
+
 private:
    // The following are not implemented:
    PatchCellDataBasicOps(
@@ -243,8 +380,6 @@ private:
    operator = (
       const PatchCellDataBasicOps&);
 
-   ArrayDataBasicOps<TYPE> d_array_ops;
-
 };
 
 }
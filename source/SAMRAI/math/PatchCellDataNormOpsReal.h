@@ -216,7 +216,7 @@ public:
     *
     * @pre data1 && data2
     */
-   TYPE
+   double
    dot(
       const std::shared_ptr<pdat::CellData<TYPE> >& data1,
       const std::shared_ptr<pdat::CellData<TYPE> >& data2,
@@ -230,7 +230,7 @@ public:
     *
     * @pre data
     */
-   TYPE
+   double
    integral(
       const std::shared_ptr<pdat::CellData<TYPE> >& data,
       const hier::Box& box,
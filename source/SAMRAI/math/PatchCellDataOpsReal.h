@@ -117,6 +117,38 @@ public:
       const TYPE& alpha,
       const hier::Box& box) const;
 
+   /**
+    * Copy src data to dst data on all local patches of a level.
+    *
+    * @param[in] level
+    * @param[in] dst_id
+    * @param[in] src_id
+    * @param[in] interior_only  If true, copy on the patch boxes, else
+    *                           on the ghost boxes of dst.
+    */
+   void
+   copyData(
+      const hier::PatchLevel& level,
+      const int dst_id,
+      const int src_id,
+      const bool interior_only) const;
+
+   /**
+    * Initialize data to given scalar on all local patches of a level.
+    *
+    * @param[in] level
+    * @param[in] dst_id
+    * @param[in] alpha
+    * @param[in] interior_only  If true, set the patch boxes, else the
+    *                           ghost boxes.
+    */
+   void
+   setToScalar(
+      const hier::PatchLevel& level,
+      const int dst_id,
+      const TYPE& alpha,
+      const bool interior_only) const;
+
 private:
    // The following are not implemented:
    PatchCellDataOpsReal(
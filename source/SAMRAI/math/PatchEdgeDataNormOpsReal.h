@@ -214,7 +214,7 @@ public:
     *
     * @pre data1 && data2
     */
-   TYPE
+   double
    dot(
       const std::shared_ptr<pdat::EdgeData<TYPE> >& data1,
       const std::shared_ptr<pdat::EdgeData<TYPE> >& data2,
@@ -228,7 +228,7 @@ public:
     *
     * @pre data
     */
-   TYPE
+   double
    integral(
       const std::shared_ptr<pdat::EdgeData<TYPE> >& data,
       const hier::Box& box,
@@ -215,7 +215,7 @@ public:
     *
     * @pre data1 && data2
     */
-   TYPE
+   double
    dot(
       const std::shared_ptr<pdat::FaceData<TYPE> >& data1,
       const std::shared_ptr<pdat::FaceData<TYPE> >& data2,
@@ -229,7 +229,7 @@ public:
     *
     * @pre data
     */
-   TYPE
+   double
    integral(
       const std::shared_ptr<pdat::FaceData<TYPE> >& data,
       const hier::Box& box,
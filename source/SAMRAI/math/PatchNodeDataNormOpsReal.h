@@ -215,7 +215,7 @@ public:
     *
     * @pre data1 && data2
     */
-   TYPE
+   double
    dot(
       const std::shared_ptr<pdat::NodeData<TYPE> >& data1,
       const std::shared_ptr<pdat::NodeData<TYPE> >& data2,
@@ -229,7 +229,7 @@ public:
     *
     * @pre data
     */
-   TYPE
+   double
    integral(
       const std::shared_ptr<pdat::NodeData<TYPE> >& data,
       const hier::Box& box,
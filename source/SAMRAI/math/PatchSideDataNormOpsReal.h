@@ -229,7 +229,7 @@ public:
     * @pre !cvol || (data1->getDim() == cvol->getDim())
     * @pre !cvol || (data1->getDirectionVector() == hier::IntVector::min(data1->getDirectionVector(), cvol->getDirectionVector()))
     */
-   TYPE
+   double
    dot(
       const std::shared_ptr<pdat::SideData<TYPE> >& data1,
       const std::shared_ptr<pdat::SideData<TYPE> >& data2,
@@ -246,7 +246,7 @@ public:
     *      (data->getDim() == box.getDim())
     * @pre data->getDirectionVector() == hier::IntVector::min(data->getDirectionVector(), vol->getDirectionVector())
     */
-   TYPE
+   double
    integral(
       const std::shared_ptr<pdat::SideData<TYPE> >& data,
       const hier::Box& box,
@@ -252,6 +252,18 @@ public:
       const hier::IntVector& min_box,
       const hier::IntVector& tag_to_new_width);
 
+   /*!
+    * @brief Implement the BoxGeneratorStrategy interface
+    * method of the same name.
+    *
+    * Tags may be given as pdat::CellTagData, so this returns true.
+    */
+   bool
+   acceptsBitTags() const
+   {
+      return true;
+   }
+
    /*!
     * @brief Duplicate the MPI communication object for private internal use.
     *
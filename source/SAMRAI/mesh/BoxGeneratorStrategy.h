@@ -53,7 +53,10 @@ public:
     * @param[out] tag_to_new Connector from the tagged to the new BoxLevels.
     * @param[in] tag_level Tagged PatchLevel.
     * @param[in] tag_data_index Index of PatchData used to denote tagging.
-    * @param[in] tag_val Value of PatchData indicating a tagged cell.
+    * It is pdat::CellData<int>, or pdat::CellTagData if acceptsBitTags()
+    * returns true.
+    * @param[in] tag_val Value of PatchData indicating a tagged cell.  For
+    * pdat::CellTagData, it must be nonzero and the tagged cells are used.
     * @param[in] bound_boxes Collection of Boxes describing the bounding box
     * of each block in the tag level.
     * @param[in] min_box Smallest box size resulting from clustering.
@@ -70,6 +73,16 @@ public:
       const hier::IntVector& min_box,
       const hier::IntVector& tag_to_new_width) = 0;
 
+   /*!
+    * @brief Tell whether findBoxesContainingTags() accepts tags held in
+    * pdat::CellTagData, one bit per cell.
+    *
+    * Callers holding bit tags give implementations that return false
+    * the tags as pdat::CellData<int>.  The default is false.
+    */
+   virtual bool
+   acceptsBitTags() const;
+
 private:
    // The following are not implemented:
    BoxGeneratorStrategy(
@@ -18,6 +18,7 @@
 #include "SAMRAI/mesh/LoadBalanceStrategy.h"
 #include "SAMRAI/mesh/GriddingAlgorithmConnectorWidthRequestor.h"
 #include "SAMRAI/mesh/MultiblockGriddingTagger.h"
+#include "SAMRAI/pdat/CellTagVariable.h"
 #include "SAMRAI/pdat/CellVariable.h"
 #include "SAMRAI/hier/Connector.h"
 #include "SAMRAI/hier/MappingConnectorAlgorithm.h"
@@ -629,7 +630,7 @@ private:
     *
     * @pre (tag_value == d_true_tag) || (tag_value == d_false_tag)
     * @pre tag_level
-    * @pre (tag_index == d_tag_indx) || (tag_index == d_buf_tag_indx)
+    * @pre (tag_index == d_user_tag_indx) || (tag_index == d_saved_tag_indx)
     */
    void
    fillTags(
@@ -668,7 +669,7 @@ private:
     *
     * @pre (tag_value == d_true_tag) || (tag_value == d_false_tag)
     * @pre tag_level
-    * @pre (index == d_tag_indx || index == d_buf_tag_indx)
+    * @pre (index == d_user_tag_indx || index == d_saved_tag_indx)
     * @pre tag_level_to_fill_box_level.getHeadCoarserFlag() == false
     */
    void
@@ -1060,13 +1061,8 @@ private:
     * @brief Set tag data that will be only have the values expected by
     * the algorithms for box generation.
     *
-    * Boolean tag data should have only values of d_true_tag or
-    * d_false_tag.  This method interprets user tag data to set
-    * boolean tag data to these values.
-    *
-    * Note that the use of the term "boolean" does not mean that the bool
-    * type is used, but that the integer data will have only two possible
-    * values.
+    * Boolean tag data is CellTagData, holding one bit per cell.  This
+    * method tags the cells whose user tag data is not d_false_tag.
     *
     * @param[in] tag_level  Level being tagged
     * @param[in] preserve_existing_tags  If set to true, any cells already
@@ -1079,6 +1075,18 @@ private:
       const std::shared_ptr<hier::PatchLevel>& tag_level,
       bool preserve_existing_tags) const;
 
+   /*!
+    * @brief Copy the boolean tag data to integer cell data holding
+    * d_true_tag and d_false_tag, for box generators that do not accept
+    * bit tags.
+    *
+    * @param[in] tag_level  Level being tagged, on which the integer
+    * boolean tag data is allocated
+    */
+   void
+   setIntegerBooleanTagData(
+      const std::shared_ptr<hier::PatchLevel>& tag_level) const;
+
    /*!
     * @brief Check for user tags that violate proper nesting.
     *
@@ -1210,18 +1218,23 @@ private:
     * distributed across processors.  d_boolean_tag_indx is used to put tag
     * values in a standard format that will be understood by box generator
     * implementations, and d_saved_tag_indx is used to preserve tag values
-    * on new levels after gridding operations are completed.  Note that
-    * d_boolean_tag does not use the bool type, but rather its associated
-    * integer data is treated as a boolean with only two possible values.
+    * on new levels after gridding operations are completed.  The user and
+    * saved tags are integer cell data, since users and StandardTagAndInitialize
+    * store values other than true and false in them.  The boolean and
+    * buffer tags are CellTagData, which holds one bit per cell.  Box
+    * generators that do not accept bit tags are given a copy of the
+    * boolean tags in d_int_boolean_tag_indx.
     */
    std::shared_ptr<pdat::CellVariable<int> > d_user_tag;
    std::shared_ptr<pdat::CellVariable<int> > d_saved_tag;
-   std::shared_ptr<pdat::CellVariable<int> > d_boolean_tag;
-   std::shared_ptr<pdat::CellVariable<int> > d_buf_tag;
+   std::shared_ptr<pdat::CellTagVariable> d_boolean_tag;
+   std::shared_ptr<pdat::CellTagVariable> d_buf_tag;
+   std::shared_ptr<pdat::CellVariable<int> > d_int_boolean_tag;
    int d_user_tag_indx;
    int d_saved_tag_indx;
    int d_boolean_tag_indx;
    int d_buf_tag_indx;
+   int d_int_boolean_tag_indx;
 
    std::shared_ptr<xfer::RefineAlgorithm> d_bdry_fill_tags;
    std::vector<std::shared_ptr<xfer::RefineSchedule> > d_bdry_sched_tags;
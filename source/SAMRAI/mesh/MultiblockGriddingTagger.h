@@ -54,8 +54,7 @@ public:
 
    /*!
     * @brief Set the patch data index for tag data.  This routine
-    * must be called with a valid cell-centered integer patch data
-    * index.
+    * must be called with a valid pdat::CellTagData patch data index.
     */
    virtual void
    setScratchTagPatchDataIndex(
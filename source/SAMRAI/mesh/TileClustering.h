@@ -19,6 +19,7 @@
 #include "SAMRAI/hier/BoxLevel.h"
 #include "SAMRAI/hier/PatchLevel.h"
 #include "SAMRAI/pdat/CellData.h"
+#include "SAMRAI/pdat/CellTagData.h"
 #include "SAMRAI/tbox/OpenMPUtilities.h"
 #include "SAMRAI/tbox/Database.h"
 
@@ -167,6 +168,18 @@ public:
       const hier::IntVector& min_box,
       const hier::IntVector& max_gcw);
 
+   /*!
+    * @brief Implement the BoxGeneratorStrategy interface
+    * method of the same name.
+    *
+    * Tags may be given as pdat::CellTagData, so this returns true.
+    */
+   bool
+   acceptsBitTags() const
+   {
+      return true;
+   }
+
    /*!
     * @brief Setup names of timers.
     */
@@ -210,7 +223,7 @@ private:
     */
    std::shared_ptr<pdat::CellData<int> >
    makeCoarsenedTagData(
-      const pdat::CellData<int>& tag_data,
+      const hier::PatchData& tag_data,
       int tag_value) const;
 
    /*!
@@ -219,10 +232,21 @@ private:
    int
    findTilesContainingTags(
       hier::BoxContainer& tiles,
-      const pdat::CellData<int>& tag_data,
+      const hier::PatchData& tag_data,
       int tag_val,
       int first_tile_index);
 
+   /*!
+    * @brief Return whether any cell of box has tag_val, in either the
+    * bit tags or the integer tags, one of which is given.
+    */
+   static bool
+   hasTagInBox(
+      const pdat::CellTagData* bit_tag_data,
+      const pdat::CellData<int>* int_tag_data,
+      const hier::Box& box,
+      int tag_val);
+
    /*!
     * @brief Cluster tags into whole tiles.  The tiles are not cut up,
     * even where they cross process boundaries or level boundaries.
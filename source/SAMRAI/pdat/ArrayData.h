@@ -22,6 +22,8 @@
 #include "SAMRAI/hier/IntVector.h"
 #include "SAMRAI/tbox/Complex.h"
 #include "SAMRAI/tbox/Database.h"
+#include "SAMRAI/tbox/MemoryPool.h"
+#include "SAMRAI/tbox/MemorySlab.h"
 #include "SAMRAI/tbox/MemoryUtilities.h"
 #include "SAMRAI/tbox/MessageStream.h"
 #include "SAMRAI/tbox/AllocatorDatabase.h"
@@ -39,6 +41,30 @@ class OuternodeData;
 template<class TYPE>
 class SideData;
 
+/*!
+ * @brief OtherPrecision<TYPE>::type is the floating point type of the
+ * other precision, float for double and double for float, and TYPE
+ * itself for all other types.
+ *
+ * The cell and side data of the two precisions copy into each other,
+ * converting each value, so that fields may be stored in float and
+ * transferred into double data for computation, and back.
+ */
+template<class TYPE>
+struct OtherPrecision {
+   typedef TYPE type;
+};
+
+template<>
+struct OtherPrecision<float> {
+   typedef double type;
+};
+
+template<>
+struct OtherPrecision<double> {
+   typedef float type;
+};
+
 /*!
  * @brief Class ArrayData<TYPE> is a basic templated array structure defined
  * over the index space of a box (with a specified depth) that provides
@@ -49,18 +75,80 @@ class SideData;
  * Memory allocation is in column-major ordering (e.g., Fortran style)
  * so that the leftmost index runs fastest in memory.
  *
+ * This is the default PLANAR depth layout, in which each component is a
+ * contiguous array.  With the INTERLEAVED depth layout, the storage is
+ * in (d,i,...,k) order instead, so that the components at a location are
+ * adjacent in memory.  This suits kernels that read all the components
+ * of a location together, such as those working on a state vector.  The
+ * layout is chosen when the array is constructed.  getPointer(d) returns
+ * the first value of component d in either layout, and getCellStride()
+ * and getDepthStride() give the distances between the values of
+ * neighboring locations and of neighboring components.  The operations
+ * of this class work for either layout and between arrays of different
+ * layouts; message streams and restart data are in the planar order
+ * whatever the layout.  getOffset() and getView() are only meaningful
+ * for the planar layouts.
+ *
+ * The PADDED layout is a planar layout in which each row along the
+ * first index is padded to a multiple of a 64 byte cache line, and each
+ * component starts on a cache line, so that loops over rows vectorize
+ * without peeling.  Component and plane sizes that are multiples of
+ * 4 KiB, common for power-of-two patches, are padded by one more line
+ * or row to keep neighboring planes from competing for the same cache
+ * sets.  The array is then laid out as a planar array over
+ * getPaddedBox(), which is larger than getBox(); views and MDA_Access
+ * objects built on getPaddedBox() have the padded strides.  The padding
+ * is never read: copies, streams and restart data cover getBox() only.
+ * Kernels that take getPointer() and the bounds of getBox(), such as
+ * the Fortran refine and coarsen kernels, need an array for which
+ * isPlanar() is true.
+ *
+ * Between PLANAR or PADDED arrays of a TYPE that may be copied bytewise,
+ * copies over part of the arrays move whole runs of cells that are
+ * contiguous in both arrays with memcpy, and fills set them in one loop.
+ * With OpenMP, large copies and fills spread their runs over threads
+ * unless they are called from a parallel region.
+ *
  * The data type TYPE must define a default constructor (that takes no
  * arguments) and also the assignment operator.  Note that a number of
  * functions only work for standard built-in types (bool, char, double,
  * float, and int).  To use this class with other user-defined types,
  * many of these functions will need to be specialized, especially those
  * that deal with message packing and unpacking.
+ *
+ * If a tbox::MemorySlab is active when an ArrayData is constructed,
+ * the array storage is carved from the slab rather than allocated on
+ * its own.  The ArrayData keeps the slab alive until it is destroyed.
+ * Otherwise, storage comes from the Umpire allocator when SAMRAI is
+ * built with Umpire, and from tbox::MemoryPool when it is not.  The
+ * values of a new array are undefined when TYPE is trivially default
+ * constructible, as for the built-in types, so users must fill the array
+ * before reading it.  Values of other types are default constructed.
  */
 
 template<class TYPE>
 class ArrayData
 {
 public:
+   /*!
+    * @brief Order of the depth components in memory.
+    *
+    *    - \b PLANAR      - each component is a contiguous array, the
+    *                       first index running fastest
+    *    - \b INTERLEAVED - the components at a location are adjacent,
+    *                       the depth running fastest
+    *    - \b PADDED      - as PLANAR, with rows and components padded
+    *                       to cache line boundaries
+    *
+    * An array of depth one is stored the same way in the PLANAR and
+    * INTERLEAVED layouts.
+    */
+   enum DepthLayout {
+      PLANAR,
+      INTERLEAVED,
+      PADDED
+   };
+
    /*!
     * Static member function that returns true when the amount of buffer space
     * in a message stream can be estimated from box only.  For built-in types
@@ -99,12 +187,14 @@ public:
     *              of the index space associated with the array data object.
     * @param depth Integer number of data values at each spatial location in
     *              the array.
+    * @param depth_layout Order of the depth components in memory.
     *
     * @pre depth > 0
     */
    ArrayData(
       const hier::Box& box,
-      unsigned int depth);
+      unsigned int depth,
+      DepthLayout depth_layout = PLANAR);
 
 #ifdef HAVE_UMPIRE
    /*!
@@ -115,13 +205,15 @@ public:
     * @param depth Integer number of data values at each spatial location in
     *              the array.
     * @param allocator An Umpire allocator
+    * @param depth_layout Order of the depth components in memory.
     *
     * @pre depth > 0
     */
    ArrayData(
       const hier::Box& box,
       unsigned int depth,
-      umpire::Allocator allocator);
+      umpire::Allocator allocator,
+      DepthLayout depth_layout = PLANAR);
 #endif
 
    /*!
@@ -139,6 +231,16 @@ public:
    bool
    isInitialized() const;
 
+   /*!
+    * @brief Returns true when the array storage was carved from a
+    * tbox::MemorySlab rather than allocated on its own.
+    */
+   bool
+   isAllocatedFromSlab() const
+   {
+      return d_slab.get() != 0;
+   }
+
    /*!
     * Set the array data to an ``undefined'' state appropriate for the data
     * type. For example, for float and double, this means setting data to
@@ -161,16 +263,85 @@ public:
    unsigned int
    getDepth() const;
 
+   /*!
+    * @brief Return the box over which the array is laid out.
+    *
+    * This is getBox() for the PLANAR and INTERLEAVED layouts.  For the
+    * PADDED layout, it is getBox() extended at the upper end of the
+    * first direction to the padded row length, and in three or more
+    * dimensions possibly by a row in the second direction.  Index
+    * arithmetic on getPointer() must use this box.
+    */
+   const hier::Box&
+   getPaddedBox() const
+   {
+      return d_padded_box;
+   }
+
    /*!
     * Return the offset (e.g., the number of data values for each
-    * depth component) of this array.
+    * depth component, including any padding) of this array.  This is
+    * used as the distance between components, so it must only be used
+    * with the planar layouts.
+    *
+    * @pre getCellStride() == 1
     */
    size_t
    getOffset() const;
 
+   /*!
+    * @brief Return true if each component is a contiguous array over
+    * getBox(), the components following one another.
+    *
+    * This is the layout of the PLANAR arrays, which arrays in the other
+    * layouts may happen to share: an INTERLEAVED array of depth one, or
+    * a PADDED array whose box needs no padding.
+    */
+   bool
+   isPlanar() const
+   {
+      return d_cell_stride == 1 && d_offset == d_box.size();
+   }
+
+   /*!
+    * @brief Return the order of the depth components in memory.
+    */
+   DepthLayout
+   getDepthLayout() const
+   {
+      return d_depth_layout;
+   }
+
+   /*!
+    * @brief Return the distance in memory between the values of a
+    * component at neighboring locations along the first index.
+    *
+    * This is one for the planar layout and the depth for the
+    * interleaved layout.
+    */
+   size_t
+   getCellStride() const
+   {
+      return d_cell_stride;
+   }
+
+   /*!
+    * @brief Return the distance in memory between the values of
+    * neighboring components at a location.
+    *
+    * This is getOffset() for the planar layouts and one for the
+    * interleaved layout.
+    */
+   size_t
+   getDepthStride() const
+   {
+      return d_depth_stride;
+   }
+
    /*!
     * Get a non-const pointer to the beginning of the given depth
-    * component of this data array.
+    * component of this data array.  Successive values of the component
+    * are getCellStride() apart.
     *
     * @pre (d >= 0) && (d < getDepth())
     */
@@ -180,7 +351,8 @@ public:
 
    /*!
     * Get a const pointer to the beginning of the given depth
-    * component of this data array.
+    * component of this data array.  Successive values of the component
+    * are getCellStride() apart.
     *
     * @pre (d >= 0) && (d < getDepth())
     */
@@ -188,7 +360,6 @@ public:
    getPointer(
       const unsigned int d = 0) const;
 
-#if defined(HAVE_RAJA)
    template<int DIM>
    using View = pdat::ArrayView<DIM, TYPE>;
 
@@ -196,7 +367,11 @@ public:
    using ConstView = pdat::ArrayView<DIM, const TYPE>;
 
    /*!
-    * @brief Get an ArrayView that can access the array for RAJA looping.
+    * @brief Get an ArrayView that can access the array in
+    * hier::parallel_for_all loops.  The view has the strides of
+    * getPaddedBox().
+    *
+    * @pre getCellStride() == 1
     */
    template <int DIM>
    View<DIM>
@@ -204,13 +379,16 @@ public:
       int depth = 0);
 
    /*!
-    * @brief Get a const ArrayView that can access the array for RAJA looping.
+    * @brief Get a const ArrayView that can access the array in
+    * hier::parallel_for_all loops.  The view has the strides of
+    * getPaddedBox().
+    *
+    * @pre getCellStride() == 1
     */
    template <int DIM>
    ConstView<DIM>
    getConstView(
       int depth = 0) const;
-#endif
 
    /*!
     * Return reference to value in this array associated with the given
@@ -319,6 +497,42 @@ public:
       const hier::BoxContainer& boxes,
       const hier::Transformation& transformation);
 
+   /*!
+    * @brief Copy data from a source array of another type on the given
+    * region, converting each value with a static_cast.
+    *
+    * This is the copy between arrays of the two floating point precisions.
+    * The source may have any layout.  As with copy(), the region is the
+    * intersection of the box with the destination box and the shifted
+    * source box, and the smaller of the two depths is copied.
+    *
+    * @param src   Source array.
+    * @param box   Region, in the destination index space.
+    * @param src_shift  Shift putting the source array into the
+    *                   destination index space.
+    *
+    * @pre (getDim() == src.getDim()) && (getDim() == box.getDim())
+    */
+   template<class SRC_TYPE>
+   void
+   copyConverted(
+      const ArrayData<SRC_TYPE>& src,
+      const hier::Box& box,
+      const hier::IntVector& src_shift);
+
+   /*!
+    * @brief Copy data from a source array of another type on the given
+    * regions, converting each value.
+    *
+    * @pre transformation.getRotation() == hier::Transformation::NO_ROTATE
+    */
+   template<class SRC_TYPE>
+   void
+   copyConverted(
+      const ArrayData<SRC_TYPE>& src,
+      const hier::BoxContainer& boxes,
+      const hier::Transformation& transformation);
+
    /*!
     * Copy given source depth of source array data object to given destination
     * depth of this array data object on the specified index space region.
@@ -496,6 +710,67 @@ public:
       const hier::BoxContainer& dest_boxes,
       const hier::Transformation& transformation) const;
 
+   /*!
+    * Set this array, on the specified index space regions, to the
+    * linear time interpolation
+    *
+    *    (1 - tfrac) * src_old + tfrac * src_new
+    *
+    * of two source arrays.  This gives the same result as interpolating
+    * into a temporary array over the source index space and copying the
+    * temporary into this array with copy(), without the temporary.
+    *
+    * @param src_old Data at the earlier time.
+    * @param src_new Data at the later time.
+    * @param tfrac   Fraction of the time interval between src_old and
+    *                src_new at which to interpolate.
+    * @param boxes   Regions to set, in the destination index space.  They
+    *                are intersected with this array's box and with the
+    *                shifted source boxes.
+    * @param transformation Transformation from the source index space to
+    *                this array's index space.
+    *
+    * @pre transformation.getRotation() == hier::Transformation::NO_ROTATE
+    * @pre (getDim() == src_old.getDim()) && (getDim() == src_new.getDim())
+    */
+   void
+   linearTimeInterpolate(
+      const ArrayData<TYPE>& src_old,
+      const ArrayData<TYPE>& src_new,
+      double tfrac,
+      const hier::BoxContainer& boxes,
+      const hier::Transformation& transformation);
+
+   /*!
+    * Pack into the stream the linear time interpolation
+    *
+    *    (1 - tfrac) * (this array) + tfrac * src_new
+    *
+    * on the specified index space regions.  The stream holds exactly
+    * what packStream() would pack from an array holding the
+    * interpolated values, so it is unpacked with unpackStream().
+    *
+    * @param stream  Stream into which to pack data.
+    * @param src_new Data at the later time.
+    * @param tfrac   Fraction of the time interval between this array and
+    *                src_new at which to interpolate.
+    * @param dest_boxes Regions to pack, in the destination index space.
+    * @param transformation Transformation from the index space of this
+    *                array to the destination index space.
+    *
+    * @pre transformation.getRotation() == hier::Transformation::NO_ROTATE
+    * @pre getDepth() == src_new.getDepth()
+    * @pre the inverse transformed boxes lie in the boxes of this array
+    *      and of src_new
+    */
+   void
+   packStreamLinearTimeInterpolated(
+      tbox::MessageStream& stream,
+      const ArrayData<TYPE>& src_new,
+      double tfrac,
+      const hier::BoxContainer& dest_boxes,
+      const hier::Transformation& transformation) const;
+
    /*!
     * Unpack data from the stream into the index region specified.
     *
@@ -671,6 +946,106 @@ private:
     */
    static const int PDAT_ARRAYDATA_VERSION;
 
+   /*
+    * Bytes to which the rows and components of PADDED arrays are
+    * padded, and multiple of bytes beyond which planes are padded
+    * against cache set aliasing.
+    */
+   static const size_t PADDED_LINE_BYTES;
+   static const size_t PADDED_ALIAS_BYTES;
+
+   /*
+    * Set d_padded_box, d_offset and the strides from d_box, d_depth
+    * and d_depth_layout.
+    */
+   void
+   initializeLayout();
+
+   /*
+    * Return true if src has the same depth and stores each of its values
+    * at the same position in its array as this array, so that the two
+    * arrays may be operated on as flat arrays.
+    */
+   bool
+   hasSameStorage(
+      const ArrayData<TYPE>& src) const
+   {
+      return d_depth == src.d_depth &&
+             d_offset == src.d_offset &&
+             d_cell_stride == src.d_cell_stride &&
+             d_depth_stride == src.d_depth_stride &&
+             d_padded_box.isSpatiallyEqual(src.d_padded_box);
+   }
+
+   /*
+    * Copies and fills over at least this many cells are threaded across
+    * their runs, and runs at least SHORT_RUN_CELLS long are copied with
+    * memcpy rather than an element loop.
+    */
+   static const size_t MIN_PARALLEL_RUN_CELLS;
+   static const size_t SHORT_RUN_CELLS;
+
+   /*
+    * Call body(dst_offset, src_offset, run_length) for each run of
+    * cells of box, in each of num_depth components, that is contiguous
+    * in planar arrays over both padded boxes.  Directions are folded
+    * into the runs while box spans both arrays in all lower directions.
+    * The offsets are relative to the first cell of box in the first
+    * component.  Planes of runs are spread over threads for large boxes.
+    */
+   template<class BODY>
+   static void
+   forAllContiguousRuns(
+      const hier::Box& box,
+      unsigned int num_depth,
+      const hier::Box& dst_padded_box,
+      size_t dst_depth_stride,
+      const hier::Box& src_padded_box,
+      size_t src_depth_stride,
+      BODY body);
+
+   /*
+    * Copy num_depth components of src over copybox, with src_shift
+    * taking copybox into the index space of src.  Contiguous runs are
+    * copied whole when both arrays allow it; otherwise the generic
+    * ArrayDataOperationUtilities loops are used.
+    */
+   void
+   copyOnBox(
+      const ArrayData<TYPE>& src,
+      const hier::Box& copybox,
+      const hier::IntVector& src_shift,
+      unsigned int dst_start_depth,
+      unsigned int src_start_depth,
+      unsigned int num_depth);
+
+   /*
+    * Run-wise versions of copyOnBox() and fill().  They return false
+    * without doing anything if an array is not planar or padded, TYPE
+    * cannot be copied bytewise, or the data may live on a device.
+    */
+   bool
+   copyContiguousRuns(
+      const ArrayData<TYPE>& src,
+      const hier::Box& copybox,
+      const hier::IntVector& src_shift,
+      unsigned int dst_start_depth,
+      unsigned int src_start_depth,
+      unsigned int num_depth);
+
+   bool
+   fillContiguousRuns(
+      const TYPE& t,
+      const hier::Box& box,
+      unsigned int d);
+
+   /*
+    * Allocate d_array, from the active tbox::MemorySlab if there is
+    * one with room, otherwise on its own.
+    */
+   void
+   allocateArray();
+
    /*
     * Private member functions to pack/unpack data to/from buffer.
     *
@@ -696,6 +1071,28 @@ private:
       const TYPE* buffer,
       const hier::Box& box);
 
+   /*
+    * Private member function to write the linear time interpolation
+    * between this array and src_new on the given box, for the first
+    * num_depth components, into dst.  dst is laid out like an array
+    * over dst_box with the given distances between cells and between
+    * components, and index i of the box goes to index i + dst_shift of
+    * dst.
+    *
+    * Note: boxes of this array and src_new must contain the given box.
+    */
+   void
+   linearTimeInterpolateOnBox(
+      TYPE* dst,
+      const hier::Box& dst_box,
+      size_t dst_cell_stride,
+      size_t dst_depth_stride,
+      const hier::IntVector& dst_shift,
+      const ArrayData<TYPE>& src_new,
+      double tfrac,
+      const hier::Box& box,
+      unsigned int num_depth) const;
+
    /*!
     * @brief Compte index into d_array for data at index i and depth d.
     *
@@ -713,16 +1110,18 @@ private:
 
    unsigned int d_depth;
    size_t d_offset;
+   DepthLayout d_depth_layout;
+   size_t d_cell_stride;
+   size_t d_depth_stride;
    hier::Box d_box;
+   hier::Box d_padded_box;
 #if defined(HAVE_UMPIRE)
    umpire::TypedAllocator<TYPE> d_allocator;
-   TYPE* d_array;
-#else
-   std::vector<TYPE> d_array;
 #endif
+   std::shared_ptr<tbox::MemorySlab> d_slab;
+   TYPE* d_array;
 };
 
-#if defined(HAVE_RAJA)
 template<int DIM, typename DATA, typename... Args>
 typename DATA::template View<DIM> get_view(std::shared_ptr<hier::PatchData> src, Args&&... args);
 
@@ -734,7 +1133,6 @@ typename ArrayData<TYPE>::template View<DIM> get_view(ArrayData<TYPE>& data, Arg
 
 template<int DIM, typename TYPE, typename... Args>
 typename ArrayData<TYPE>::template ConstView<DIM> get_const_view(const ArrayData<TYPE>& data, Args&&... args);
-#endif
 
 }
 }
@@ -12,6 +12,7 @@
 
 #include "SAMRAI/SAMRAI_config.h"
 #include "SAMRAI/pdat/ArrayData.h"
+#include "SAMRAI/pdat/ConvertingAccess.h"
 #include "SAMRAI/pdat/MDA_Access.h"
 
 namespace SAMRAI {
@@ -31,30 +32,72 @@ class ArrayDataAccess
 public:
    /*!
     * @brief Create an MDA_Access version of an ArrayData object.
+    *
+    * The access has the strides of ArrayData::getPaddedBox().
+    *
+    * @pre array_data.getCellStride() == 1
     */
    template<int DIM, class TYPE>
    static MDA_Access<TYPE, DIM, MDA_OrderColMajor<DIM> >
    access(
       ArrayData<TYPE>& array_data,
       int depth = 0) {
+      TBOX_ASSERT(array_data.getCellStride() == 1);
       return MDA_Access<TYPE, DIM, MDA_OrderColMajor<DIM> >(
                 array_data.getPointer(depth),
-                &array_data.getBox().lower()[0],
-                &array_data.getBox().upper()[0]);
+                &array_data.getPaddedBox().lower()[0],
+                &array_data.getPaddedBox().upper()[0]);
    }
 
    /*!
     * @brief Create an MDA_AccessConst version of a const ArrayData object.
+    *
+    * The access has the strides of ArrayData::getPaddedBox().
+    *
+    * @pre array_data.getCellStride() == 1
     */
    template<int DIM, class TYPE>
    static MDA_AccessConst<TYPE, DIM, MDA_OrderColMajor<DIM> >
    access(
       const ArrayData<TYPE>& array_data,
       int depth = 0) {
+      TBOX_ASSERT(array_data.getCellStride() == 1);
       return MDA_AccessConst<TYPE, DIM, MDA_OrderColMajor<DIM> >(
                 array_data.getPointer(depth),
-                &array_data.getBox().lower()[0],
-                &array_data.getBox().upper()[0]);
+                &array_data.getPaddedBox().lower()[0],
+                &array_data.getPaddedBox().upper()[0]);
+   }
+
+   /*!
+    * @brief Create an access to an ArrayData object that reads and
+    * writes values of ACCESS_TYPE, such as double access to float data.
+    *
+    * @pre array_data.getCellStride() == 1
+    */
+   template<int DIM, class ACCESS_TYPE, class TYPE>
+   static ConvertingAccess<ACCESS_TYPE,
+                           MDA_Access<TYPE, DIM, MDA_OrderColMajor<DIM> > >
+   accessAs(
+      ArrayData<TYPE>& array_data,
+      int depth = 0) {
+      return makeConvertingAccess<ACCESS_TYPE>(
+                access<DIM>(array_data, depth));
+   }
+
+   /*!
+    * @brief Create a read-only access to a const ArrayData object that
+    * reads values of ACCESS_TYPE.
+    *
+    * @pre array_data.getCellStride() == 1
+    */
+   template<int DIM, class ACCESS_TYPE, class TYPE>
+   static ConvertingAccess<ACCESS_TYPE,
+                           MDA_AccessConst<TYPE, DIM, MDA_OrderColMajor<DIM> > >
+   accessAs(
+      const ArrayData<TYPE>& array_data,
+      int depth = 0) {
+      return makeConvertingAccess<ACCESS_TYPE>(
+                access<DIM>(array_data, depth));
    }
 
 };
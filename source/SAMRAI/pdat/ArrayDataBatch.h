@@ -0,0 +1,337 @@
+/*************************************************************************
+ *
+ * This file is part of the SAMRAI distribution.  For full copyright
+ * information, see COPYRIGHT and LICENSE.
+ *
+ * Copyright:     (c) 1997-2020 Lawrence Livermore National Security, LLC
+ * Description:   Descriptor array for loops over the array data of many
+ *                patches
+ *
+ ************************************************************************/
+
+#ifndef included_pdat_ArrayDataBatch
+#define included_pdat_ArrayDataBatch
+
+#include "SAMRAI/SAMRAI_config.h"
+
+#include "SAMRAI/hier/Box.h"
+#include "SAMRAI/pdat/ArrayData.h"
+#include "SAMRAI/tbox/Dimension.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace SAMRAI {
+namespace pdat {
+
+/*!
+ * @brief Descriptor array of ArrayData objects and boxes, used to run
+ * one threaded loop over the cells of many patches.
+ *
+ * When a level has many small patches, running a kernel patch by patch
+ * costs a virtual call, a data lookup and a loop prologue per patch,
+ * which can take longer than the kernel itself.  An ArrayDataBatch
+ * gathers the ArrayData of one variable on every local patch, with the
+ * box to operate on in each, so that forAllRows() can iterate over all
+ * of them at once.
+ *
+ * The cells of an entry are visited in rows, a row being the cells
+ * of one depth component with the same indices in every direction but
+ * the first.  Rows are contiguous in memory, so only arrays in the
+ * ArrayData::PLANAR and ArrayData::PADDED layouts may be batched.
+ * forAllRows() splits the rows of all entries evenly among the OpenMP
+ * threads and passes each one to the loop body as a Row.  The body
+ * obtains the data of the row with getPointer() or getConstPointer().
+ *
+ * Batches of several variables built with the same boxes, entry by
+ * entry, are aligned: a Row from one may be given to getPointer() of
+ * the others.  This is how kernels with several operands are written:
+ *
+ * \verbatim
+ *
+ * dst.forAllRows([&](const ArrayDataBatch<double>::Row& row) {
+ *    double* d = dst.getPointer(row);
+ *    const double* s = src.getConstPointer(row);
+ *    for (int i = 0; i < row.length; ++i) {
+ *       d[i] = 2.0 * s[i];
+ *    }
+ * });
+ *
+ * \endverbatim
+ *
+ * A batch refers to the ArrayData it is given, which must not be
+ * reallocated while the batch is in use.
+ *
+ * @see math::HierarchyCellDataOpsReal
+ */
+template<class TYPE>
+class ArrayDataBatch
+{
+public:
+   /*!
+    * @brief Loops with fewer cells than this are not threaded.
+    */
+   static const size_t MIN_PARALLEL_CELLS = 4096;
+
+   /*!
+    * @brief A row of cells of one entry, as passed to the body of
+    * forAllRows().
+    */
+   struct Row {
+      /*!
+       * @brief Number of the entry, in the order added.
+       */
+      int entry;
+
+      /*!
+       * @brief Depth component.
+       */
+      int depth;
+
+      /*!
+       * @brief Number of cells in the row.
+       */
+      int length;
+
+      /*!
+       * @brief Index of the first cell of the row.
+       */
+      int index[SAMRAI::MAX_DIM_VAL];
+   };
+
+   /*!
+    * @brief Construct an empty batch.
+    *
+    * @param[in] dim
+    */
+   explicit ArrayDataBatch(
+      const tbox::Dimension& dim);
+
+   /*!
+    * @brief Destructor.
+    */
+   ~ArrayDataBatch();
+
+   /*!
+    * @brief Add an entry whose data will be written.
+    *
+    * @param[in] data
+    * @param[in] box  Cells to loop over.  Only the part inside the box
+    *                 of data is used.
+    *
+    * @pre data.getDim() == box.getDim()
+    * @pre data.getCellStride() == 1
+    */
+   void
+   append(
+      ArrayData<TYPE>& data,
+      const hier::Box& box)
+   {
+      appendEntry(data, box, true);
+   }
+
+   /*!
+    * @brief Add an entry whose data will only be read.
+    *
+    * @param[in] data
+    * @param[in] box  Cells to loop over.  Only the part inside the box
+    *                 of data is used.
+    *
+    * @pre data.getDim() == box.getDim()
+    * @pre data.getCellStride() == 1
+    */
+   void
+   append(
+      const ArrayData<TYPE>& data,
+      const hier::Box& box)
+   {
+      appendEntry(data, box, false);
+   }
+
+   /*!
+    * @brief Remove all entries.
+    */
+   void
+   clear();
+
+   /*!
+    * @brief Reserve space for a number of entries.
+    */
+   void
+   reserve(
+      size_t num_entries)
+   {
+      d_entries.reserve(num_entries);
+      d_row_begin.reserve(num_entries + 1);
+   }
+
+   /*!
+    * @brief Return the number of entries.
+    */
+   int
+   getNumberOfEntries() const
+   {
+      return static_cast<int>(d_entries.size());
+   }
+
+   /*!
+    * @brief Return the total number of cells, over all depths, in the
+    * boxes of the entries.
+    */
+   size_t
+   getNumberOfCells() const
+   {
+      return d_num_cells;
+   }
+
+   /*!
+    * @brief Return the box of an entry.
+    *
+    * @param[in] entry
+    */
+   const hier::Box&
+   getBox(
+      int entry) const
+   {
+      TBOX_ASSERT(entry >= 0 && entry < getNumberOfEntries());
+      return d_entries[entry].d_box;
+   }
+
+   /*!
+    * @brief Return whether this batch has the same boxes and depths as
+    * another, so that their rows correspond.
+    *
+    * @param[in] other
+    */
+   bool
+   isAlignedWith(
+      const ArrayDataBatch& other) const;
+
+   /*!
+    * @brief Return a pointer to the first cell of a row, in the data of
+    * this batch.
+    *
+    * @param[in] row  A Row of this batch or of one aligned with it.
+    *
+    * @pre the entry was added as writable
+    */
+   TYPE *
+   getPointer(
+      const Row& row) const
+   {
+      TBOX_ASSERT(d_entries[row.entry].d_writable);
+      return d_entries[row.entry].d_pointer + getOffset(row);
+   }
+
+   /*!
+    * @brief Return a pointer to the first cell of a row, in the data of
+    * this batch.
+    *
+    * @param[in] row  A Row of this batch or of one aligned with it.
+    */
+   const TYPE *
+   getConstPointer(
+      const Row& row) const
+   {
+      return d_entries[row.entry].d_pointer + getOffset(row);
+   }
+
+   /*!
+    * @brief Call a loop body for every row of every entry.
+    *
+    * The body is called as body(row) with a const Row&.  Rows are
+    * split evenly among threads when OpenMP is enabled, the loop is not
+    * inside a parallel region and it has at least MIN_PARALLEL_CELLS
+    * cells.  Each thread gets a contiguous range of rows, so
+    * neighboring patches are handled by the same thread.
+    *
+    * @param[in] body
+    */
+   template<class BODY>
+   void
+   forAllRows(
+      BODY body) const;
+
+private:
+   struct Entry {
+      hier::Box d_box;
+      TYPE* d_pointer;
+      size_t d_depth_stride;
+      ptrdiff_t d_zero_offset;
+      ptrdiff_t d_stride[SAMRAI::MAX_DIM_VAL];
+      int d_depth;
+      bool d_writable;
+
+      Entry(
+         const hier::Box& box):
+         d_box(box)
+      {
+      }
+   };
+
+   // Unimplemented copy constructor.
+   ArrayDataBatch(
+      const ArrayDataBatch& other);
+
+   // Unimplemented assignment operator.
+   ArrayDataBatch&
+   operator = (
+      const ArrayDataBatch& rhs);
+
+   void
+   appendEntry(
+      const ArrayData<TYPE>& data,
+      const hier::Box& box,
+      bool writable);
+
+   /*!
+    * @brief Return the offset of the first cell of a row from the
+    * start of the entry's data.
+    */
+   ptrdiff_t
+   getOffset(
+      const Row& row) const
+   {
+      const Entry& entry = d_entries[row.entry];
+      ptrdiff_t offset = entry.d_zero_offset
+         + static_cast<ptrdiff_t>(row.depth * entry.d_depth_stride);
+      for (unsigned short d = 0; d < d_dim.getValue(); ++d) {
+         offset += row.index[d] * entry.d_stride[d];
+      }
+      return offset;
+   }
+
+   /*!
+    * @brief Set a row to the first row of an entry.
+    */
+   void
+   setFirstRow(
+      int entry,
+      Row& row) const;
+
+   /*!
+    * @brief Move a row to the next row of its entry.
+    */
+   void
+   advanceRow(
+      Row& row) const;
+
+   const tbox::Dimension d_dim;
+
+   std::vector<Entry> d_entries;
+
+   /*!
+    * @brief Number of the first row of each entry, with the total
+    * number of rows at the end.
+    */
+   std::vector<size_t> d_row_begin;
+
+   size_t d_num_cells;
+};
+
+}
+}
+
+#include "SAMRAI/pdat/ArrayDataBatch.C"
+
+#endif
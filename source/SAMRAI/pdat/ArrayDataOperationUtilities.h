@@ -96,6 +96,9 @@ public:
     * @pre arraydata.getDim() == opbox.getDim()
     * @pre buffer != 0
     * @pre opbox.isSpatiallyEqual(opbox * arraydata.getBox())
+    *
+    * The buffer holds the depth components one after the other over
+    * opbox, whatever the depth layout of the array data object.
     */
    static void
    doArrayDataBufferOperationOnBox(
@@ -105,6 +108,29 @@ public:
       bool src_is_buffer,
       const OP& op);
 private:
+   /*
+    * Versions of the operations above used when an array is not in the
+    * planar depth layout.  The buffer is always in planar order.
+    */
+   static void
+   doStridedOperationOnBox(
+      ArrayData<TYPE>& dst,
+      const ArrayData<TYPE>& src,
+      const hier::Box& opbox,
+      const hier::IntVector& src_shift,
+      unsigned int dst_start_depth,
+      unsigned int src_start_depth,
+      unsigned int num_depth,
+      const OP& op);
+
+   static void
+   doStridedBufferOperationOnBox(
+      const ArrayData<TYPE>& arraydata,
+      const TYPE * buffer,
+      const hier::Box& opbox,
+      bool src_is_buffer,
+      const OP& op);
+
    // the following are not implemented:
    ArrayDataOperationUtilities();
    ~ArrayDataOperationUtilities();
@@ -4,7 +4,7 @@
  * information, see COPYRIGHT and LICENSE.
  *
  * Copyright:     (c) 1997-2020 Lawrence Livermore National Security, LLC
- * Description:   Templated class providing RAJA indexing into data
+ * Description:   Templated class providing indexing into data for loops
  *
  ************************************************************************/
 
@@ -13,6 +13,12 @@
 
 #include "SAMRAI/SAMRAI_config.h"
 
+#include "SAMRAI/hier/Box.h"
+#include "SAMRAI/tbox/Utilities.h"
+
+#include <array>
+#include <cstddef>
+
 #if defined(HAVE_RAJA)
 
 #include "RAJA/RAJA.hpp"
@@ -33,8 +39,9 @@ struct layout_traits {
 /*!
  * @brief ArrayView<DIM,TYPE> is a templated struct that provides an
  * indexing interface into the arrays held by class ArrayData<TYPE> for
- * use within RAJA loops as defined by the hier::parallel_for_all loops
- * provided in the file ForAll.h
+ * use within the hier::parallel_for_all loops provided in the file
+ * ForAll.h.  With RAJA it is a RAJA::View; otherwise it is a plain
+ * offset view defined below.
  *
  * This can be used with any of the standard PatchData implementations
  * that depend on ArrayData in the pdat component of SAMRAI: CellData,
@@ -148,6 +155,108 @@ struct ArrayView<3, const TYPE> : public RAJA::View<const TYPE, detail::layout_t
 }
 }
 
+#else // HAVE_RAJA
+
+namespace SAMRAI {
+namespace pdat {
+
+/*!
+ * @brief ArrayView<DIM,TYPE> provides an indexing interface into the
+ * arrays held by class ArrayData<TYPE> for use within the
+ * hier::parallel_for_all loops provided in the file ForAll.h.
+ *
+ * This is the implementation used without RAJA.  The view holds a
+ * pointer to the array and the strides of the box, so it is cheap to
+ * capture by value in a loop body.  The first index varies fastest, as
+ * in ArrayData.  A const view is obtained with a const TYPE, as in
+ * ArrayView<3, const double>.  As with RAJA::View, shift() returns a
+ * view whose index space is moved by the given amounts, so that
+ * shift(s)(i) is the element (i - s) of the original view.
+ *
+ * See the RAJA implementation above for a usage example.
+ */
+template<int DIM, class TYPE>
+struct ArrayView {};
+
+template<class TYPE>
+struct ArrayView<1, TYPE>
+{
+   SAMRAI_INLINE ArrayView<1, TYPE>(TYPE* data, const hier::Box& box) :
+      d_data(data),
+      d_lower0(box.lower()[0]) {}
+
+   SAMRAI_INLINE TYPE& operator () (int i) const
+   {
+      return d_data[i - d_lower0];
+   }
+
+   ArrayView<1, TYPE> shift(const std::array<int, 1>& s) const
+   {
+      ArrayView<1, TYPE> view(*this);
+      view.d_lower0 += s[0];
+      return view;
+   }
+
+   TYPE* d_data;
+   int d_lower0;
+};
+
+template<class TYPE>
+struct ArrayView<2, TYPE>
+{
+   SAMRAI_INLINE ArrayView<2, TYPE>(TYPE* data, const hier::Box& box) :
+      d_data(data),
+      d_stride1(box.upper()[0] - box.lower()[0] + 1),
+      d_offset(box.lower()[0] + static_cast<std::ptrdiff_t>(box.lower()[1]) * d_stride1) {}
+
+   SAMRAI_INLINE TYPE& operator () (int i, int j) const
+   {
+      return d_data[i + static_cast<std::ptrdiff_t>(j) * d_stride1 - d_offset];
+   }
+
+   ArrayView<2, TYPE> shift(const std::array<int, 2>& s) const
+   {
+      ArrayView<2, TYPE> view(*this);
+      view.d_offset += s[0] + s[1] * d_stride1;
+      return view;
+   }
+
+   TYPE* d_data;
+   std::ptrdiff_t d_stride1;
+   std::ptrdiff_t d_offset;
+};
+
+template<class TYPE>
+struct ArrayView<3, TYPE>
+{
+   SAMRAI_INLINE ArrayView<3, TYPE>(TYPE* data, const hier::Box& box) :
+      d_data(data),
+      d_stride1(box.upper()[0] - box.lower()[0] + 1),
+      d_stride2(d_stride1 * (box.upper()[1] - box.lower()[1] + 1)),
+      d_offset(box.lower()[0] + box.lower()[1] * d_stride1
+               + box.lower()[2] * d_stride2) {}
+
+   SAMRAI_INLINE TYPE& operator () (int i, int j, int k) const
+   {
+      return d_data[i + j * d_stride1 + k * d_stride2 - d_offset];
+   }
+
+   ArrayView<3, TYPE> shift(const std::array<int, 3>& s) const
+   {
+      ArrayView<3, TYPE> view(*this);
+      view.d_offset += s[0] + s[1] * d_stride1 + s[2] * d_stride2;
+      return view;
+   }
+
+   TYPE* d_data;
+   std::ptrdiff_t d_stride1;
+   std::ptrdiff_t d_stride2;
+   std::ptrdiff_t d_offset;
+};
+
+}
+}
+
 #endif // HAVE_RAJA
 
 #endif
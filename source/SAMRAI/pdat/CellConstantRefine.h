@@ -298,6 +298,14 @@ public:
       TBOX_ASSERT(t_overlap != 0);
 
       const hier::BoxContainer& boxes = t_overlap->getDestinationBoxContainer();
+#if !defined(HAVE_CUDA)
+      refine(fine,
+         coarse,
+         dst_component,
+         src_component,
+         boxes,
+         ratio);
+#else
       for (hier::BoxContainer::const_iterator b = boxes.begin();
            b != boxes.end(); ++b) {
          refine(fine,
@@ -307,6 +315,7 @@ public:
             *b,
             ratio);
       }
+#endif
    }
 
    /**
@@ -326,6 +335,22 @@ public:
       const int src_component,
       const hier::Box& fine_box,
       const hier::IntVector& ratio) const;
+
+   /**
+    * Refine the source component on the coarse patch to the destination
+    * component on the fine patch on every box of fine_boxes.  All boxes
+    * and depths are done in one threaded loop over the rows of the fine
+    * data, using a pdat::ArrayDataBatch, so many small boxes cost about
+    * as much as one large one.  The data must be in host memory.
+    */
+   void
+   refine(
+      hier::Patch& fine,
+      const hier::Patch& coarse,
+      const int dst_component,
+      const int src_component,
+      const hier::BoxContainer& fine_boxes,
+      const hier::IntVector& ratio) const;
 };
 
 
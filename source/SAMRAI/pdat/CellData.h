@@ -24,6 +24,7 @@
 
 #include <iostream>
 #include <memory>
+#include <vector>
 
 namespace SAMRAI {
 namespace pdat {
@@ -56,6 +57,21 @@ namespace pdat {
  * The data type TYPE must define a default constructor (i.e., taking no
  * arguments) and also the copy assignment operator.
  *
+ * Data that holds one value per depth component over the whole ghost
+ * box, such as the ambient state far from any feature, may be held as
+ * uniform data: compactIfUniform() or setUniform() release the array and
+ * keep only those values.  Fills that leave the data uniform, copies and
+ * stream unpacking from uniform data holding the same values, and
+ * CellConstantRefine and the Cartesian conservative refine and coarsen
+ * operators from uniform sources keep the data uniform; a uniform
+ * source packs its values rather than those of the whole overlap.  Any
+ * other write, and any access to the array through getPointer(),
+ * getView(), operator()() or getArrayData(), allocates the array and
+ * fills it with the values first.  Since this may happen through the
+ * const accessors too, concurrent first access to uniform data from
+ * several threads is not safe.  Pointers, views and references to the
+ * array are invalidated when it is released.
+ *
  * @see ArrayData
  * @see hier::PatchData
  * @see CellDataFactory
@@ -105,6 +121,8 @@ public:
     * @param ghosts const IntVector reference indicating the width
     *              of the ghost cell region around the box over which
     *              the node data will be allocated.
+    * @param depth_layout how the depth components are arranged in memory;
+    *              see ArrayData.
     *
     * @pre box.getDim() == ghosts.getDim()
     * @pre depth > 0
@@ -113,7 +131,9 @@ public:
    CellData(
       const hier::Box& box,
       int depth,
-      const hier::IntVector& ghosts);
+      const hier::IntVector& ghosts,
+      typename ArrayData<TYPE>::DepthLayout depth_layout =
+         ArrayData<TYPE>::PLANAR);
 
 #if defined(HAVE_UMPIRE)
    /*!
@@ -129,6 +149,8 @@ public:
     *              the node data will be allocated.
     * @param allocator An Umpire allocator to manage the allocation of the
     *                  underlying data.
+    * @param depth_layout how the depth components are arranged in memory;
+    *              see ArrayData.
     *
     * @pre box.getDim() == ghosts.getDim()
     * @pre depth > 0
@@ -138,7 +160,9 @@ public:
       const hier::Box& box,
       int depth,
       const hier::IntVector& ghosts,
-      umpire::Allocator allocator);
+      umpire::Allocator allocator,
+      typename ArrayData<TYPE>::DepthLayout depth_layout =
+         ArrayData<TYPE>::PLANAR);
 #endif
 
    /*!
@@ -153,6 +177,58 @@ public:
    int
    getDepth() const;
 
+   /*!
+    * @brief Return how the depth components are arranged in memory.
+    */
+   typename ArrayData<TYPE>::DepthLayout
+   getDepthLayout() const
+   {
+      return d_depth_layout;
+   }
+
+   /*!
+    * @brief Return whether the data is held as one value per depth
+    * component instead of an array.
+    */
+   bool
+   isUniform() const
+   {
+      return !d_data;
+   }
+
+   /*!
+    * @brief Return the value of all cells at the given depth of uniform
+    * data.
+    *
+    * @pre isUniform()
+    * @pre (depth >= 0) && (depth < getDepth())
+    */
+   const TYPE&
+   getUniformValue(
+      int depth = 0) const;
+
+   /*!
+    * @brief Set all values at each depth, including ghost cells, to t and
+    * release the array.
+    *
+    * Pointers, views and references to the array become invalid.
+    */
+   void
+   setUniform(
+      const TYPE& t);
+
+   /*!
+    * @brief Release the array if each depth component holds a single
+    * value over the ghost box, keeping those values.
+    *
+    * Pointers, views and references to the array become invalid if it is
+    * released.
+    *
+    * @return Whether the data is uniform.
+    */
+   bool
+   compactIfUniform();
+
    /*!
     * @brief Get a pointer to the beginning of a depth
     * component of the cell centered array.
@@ -173,7 +249,6 @@ public:
    getPointer(
       int depth = 0) const;
 
-#if defined(HAVE_RAJA)
    template<int DIM>
    using View = pdat::ArrayView<DIM, TYPE>;
 
@@ -181,7 +256,13 @@ public:
    using ConstView = pdat::ArrayView<DIM, const TYPE>;
 
    /*!
-    * @brief Get an ArrayView that can access the array for RAJA looping.
+    * @brief Get an ArrayView that can access the array in
+    * hier::parallel_for_all loops.
+    *
+    * The view has the strides of ArrayData::getPaddedBox(), which
+    * differ from those of the ghost box for the ArrayData::PADDED
+    * layout.  Views are not available for the ArrayData::INTERLEAVED
+    * layout.
     */
    template <int DIM>
    View<DIM>
@@ -189,13 +270,18 @@ public:
       int depth = 0);
 
    /*!
-    * @brief Get a const ArrayView that can access the array for RAJA looping.
+    * @brief Get a const ArrayView that can access the array in
+    * hier::parallel_for_all loops.
+    *
+    * The view has the strides of ArrayData::getPaddedBox(), which
+    * differ from those of the ghost box for the ArrayData::PADDED
+    * layout.  Views are not available for the ArrayData::INTERLEAVED
+    * layout.
     */
    template <int DIM>
    ConstView<DIM>
    getConstView(
       int depth = 0) const;
-#endif
 
    /*!
     * @brief Return reference to cell data entry corresponding
@@ -242,8 +328,9 @@ public:
     * Data is copied where there is overlap in the underlying index space.
     * The copy is performed on the interior plus the ghost cell width (for
     * both the source and destination).  Currently, source data must be
-    * CellData of the same DIM and TYPE.  If not, then an unrecoverable
-    * error results.
+    * CellData of the same DIM and TYPE, or of the other floating point
+    * precision (see OtherPrecision), in which case each value is
+    * converted.  If not, then an unrecoverable error results.
     *
     * @pre getArrayData().getDim() == src.getDim()
     */
@@ -258,11 +345,10 @@ public:
     * Data is copied where there is overlap in the underlying index space.
     * The copy is performed on the interior plus the ghost cell width (for
     * both the source and destination).  Currently, destination data must be
-    * CellData of the same DIM and TYPE.  If not, then an unrecoverable
-    * error results.
+    * CellData of the same DIM and TYPE, or of the other floating point
+    * precision.  If not, then an unrecoverable error results.
     *
     * @pre getArrayData().getDim() == dst.getDim()
-    * @pre dynamic_cast<CellData<TYPE> *>(&dst) != 0
     */
    virtual void
    copy2(
@@ -272,9 +358,10 @@ public:
     * @brief Copy data from source to destination (i.e., this)
     * patch data object on the given overlap.
     *
-    * Currently, source data must be CellData of the same DIM and TYPE
-    * and the overlap must be a CellOverlap of the same DIM.
-    * If not, then an unrecoverable error results.
+    * Currently, source data must be CellData of the same DIM and TYPE,
+    * or of the other floating point precision, and the overlap must be a
+    * CellOverlap of the same DIM.  If not, then an unrecoverable error
+    * results.
     */
    virtual void
    copy(
@@ -285,11 +372,11 @@ public:
     * @brief Copy data from source (i.e., this) to destination
     * patch data object on the given overlap.
     *
-    * Currently, destination data must be CellData of the same DIM and TYPE
-    * and the overlap must be a CellOverlap of the same DIM.
-    * If not, then an unrecoverable error results.
+    * Currently, destination data must be CellData of the same DIM and
+    * TYPE, or of the other floating point precision, and the overlap must
+    * be a CellOverlap of the same DIM.  If not, then an unrecoverable
+    * error results.
     *
-    * @pre dynamic_cast<CellData<TYPE> *>(&dst) != 0
     * @pre dynamic_cast<const CellOverlap *>(&overlap) != 0
     */
    virtual void
@@ -338,7 +425,8 @@ public:
     * region.
     *
     * This routine is defined for the standard types (bool, char,
-    * double, float, int, and dcomplex).
+    * double, float, int, and dcomplex).  The size is that of the values
+    * of the whole overlap also for uniform data, which packs fewer.
     *
     * @pre dynamic_cast<const CellOverlap *>(&overlap) != 0
     */
@@ -347,9 +435,10 @@ public:
       const hier::BoxOverlap& overlap) const;
 
    /*!
-    * @brief Unpack data from stream into this patch data object over
+    * @brief Pack data from this patch data object into the stream over
     * the specified box overlap region.  The overlap must be a
-    * CellOverlap of the same DIM.
+    * CellOverlap of the same DIM.  Uniform data packs only its value
+    * at each depth.
     *
     * @pre dynamic_cast<const CellOverlap *>(&overlap) != 0
     */
@@ -358,6 +447,42 @@ public:
       tbox::MessageStream& stream,
       const hier::BoxOverlap& overlap) const;
 
+   /*!
+    * @brief Set this patch data, over the overlap, to the linear time
+    * interpolation (1 - tfrac) * src_old + tfrac * src_new.
+    *
+    * The result is what copy() would give from CellData holding the
+    * interpolated values, computed without such a temporary.
+    *
+    * @pre dynamic_cast<const CellOverlap *>(&overlap) != 0
+    * @pre overlap.getTransformation().getRotation() ==
+    *      hier::Transformation::NO_ROTATE
+    */
+   void
+   linearTimeInterpolate(
+      const CellData<TYPE>& src_old,
+      const CellData<TYPE>& src_new,
+      double tfrac,
+      const hier::BoxOverlap& overlap);
+
+   /*!
+    * @brief Pack into the stream, over the overlap, the linear time
+    * interpolation (1 - tfrac) * (this data) + tfrac * src_new.
+    *
+    * The stream holds what packStream() would pack from CellData holding
+    * the interpolated values, so it is unpacked with unpackStream().
+    *
+    * @pre dynamic_cast<const CellOverlap *>(&overlap) != 0
+    * @pre overlap.getTransformation().getRotation() ==
+    *      hier::Transformation::NO_ROTATE
+    */
+   void
+   packStreamLinearTimeInterpolated(
+      tbox::MessageStream& stream,
+      const CellData<TYPE>& src_new,
+      double tfrac,
+      const hier::BoxOverlap& overlap) const;
+
    /*!
     * @brief Unpack data from stream into this patch data object
     * over the specified box overlap region.  The overlap must be a
@@ -529,6 +654,12 @@ private:
     */
    static const int PDAT_CELLDATA_VERSION;
 
+   /*
+    * Leading entry of packed streams, telling whether the values of the
+    * overlap or those of uniform data follow.
+    */
+   enum StreamContents { ARRAY_STREAM = 0, UNIFORM_STREAM = 1 };
+
    // Unimplemented copy constructor
    CellData(
       const CellData&);
@@ -538,6 +669,41 @@ private:
    operator = (
       const CellData&);
 
+   /*
+    * Allocate the array of uniform data and fill it with the values.
+    */
+   void
+   materialize() const;
+
+   /*
+    * Fill the box with the values of uniform data, one per depth.
+    */
+   void
+   fillUniform(
+      const std::vector<TYPE>& values,
+      const hier::Box& box);
+
+   /*
+    * Compute the regions of the destination ghost box set by copying
+    * from a source ghost box, on the overlap if one is given.
+    */
+   static void
+   getUniformFillBoxes(
+      hier::BoxContainer& fill_boxes,
+      const hier::Box& src_ghost_box,
+      const hier::Box& dst_ghost_box,
+      const CellOverlap* overlap);
+
+   /*
+    * Interpolate the values of uniform data in time.
+    */
+   static void
+   interpolateUniform(
+      std::vector<TYPE>& values,
+      const CellData<TYPE>& src_old,
+      const CellData<TYPE>& src_new,
+      double tfrac);
+
    void
    copyWithRotation(
       const CellData<TYPE>& src,
@@ -548,22 +714,42 @@ private:
       tbox::MessageStream& stream,
       const CellOverlap& overlap) const;
 
+   /*
+    * Copy into CellData of the other floating point precision, on the
+    * overlap if one is given and on the common ghost region otherwise.
+    */
+   void
+   copyConvertedTo(
+      hier::PatchData& dst,
+      const CellOverlap* overlap) const;
+
    int d_depth;
 
-   std::shared_ptr<ArrayData<TYPE> > d_data;
+   typename ArrayData<TYPE>::DepthLayout d_depth_layout;
+
+#ifdef HAVE_UMPIRE
+   std::shared_ptr<umpire::Allocator> d_allocator;
+#endif
+
+   /*
+    * The array is null while the data is uniform, when d_uniform_values
+    * holds the value of each depth.  Both are mutable since the const
+    * accessors materialize the array.
+    */
+   mutable std::shared_ptr<ArrayData<TYPE> > d_data;
+
+   mutable std::vector<TYPE> d_uniform_values;
 
    static std::shared_ptr<tbox::Timer> t_copy;
 
 };
 
 
-#if defined(HAVE_RAJA)
 template<int DIM, typename TYPE, typename... Args>
 typename CellData<TYPE>::template View<DIM> get_view(CellData<TYPE>& data, Args&&... args);
 
 template<int DIM, typename TYPE, typename... Args>
 typename CellData<TYPE>::template ConstView<DIM> get_const_view(const CellData<TYPE>& data, Args&&... args);
-#endif
 
 
 }
@@ -17,6 +17,7 @@
 #include "SAMRAI/hier/BoxGeometry.h"
 #include "SAMRAI/hier/IntVector.h"
 #include "SAMRAI/hier/PatchDataFactory.h"
+#include "SAMRAI/pdat/ArrayData.h"
 #include "SAMRAI/tbox/Complex.h"
 
 #include <memory>
@@ -46,14 +47,18 @@ public:
    /**
     * The default constructor for the cell data factory class.  The ghost
     * cell width and depth (number of components) arguments give the defaults
-    * for all cell data objects created with this factory.
+    * for all cell data objects created with this factory.  The depth layout
+    * argument gives the arrangement of their depth components in memory;
+    * see ArrayData.
     *
     * @pre depth > 0
     * @pre ghosts.min() >= 0
     */
    CellDataFactory(
       int depth,
-      const hier::IntVector& ghosts);
+      const hier::IntVector& ghosts,
+      typename ArrayData<TYPE>::DepthLayout depth_layout =
+         ArrayData<TYPE>::PLANAR);
 
 #if defined(HAVE_UMPIRE)
    /**
@@ -67,7 +72,9 @@ public:
    CellDataFactory(
       int depth,
       const hier::IntVector& ghosts,
-      umpire::Allocator allocator);
+      umpire::Allocator allocator,
+      typename ArrayData<TYPE>::DepthLayout depth_layout =
+         ArrayData<TYPE>::PLANAR);
 #endif
 
    /**
@@ -121,6 +128,16 @@ public:
    int
    getDepth() const;
 
+   /**
+    * Get the arrangement in memory of the depth components of the data
+    * objects created by this factory.
+    */
+   typename ArrayData<TYPE>::DepthLayout
+   getDepthLayout() const
+   {
+      return d_depth_layout;
+   }
+
    /**
     * Calculate the amount of memory needed to store the cell data object,
     * including object data and dynamically allocated data.
@@ -151,7 +168,8 @@ public:
    /**
     * Return whether it is valid to copy this CellDataFactory to the
     * supplied destination patch data factory. It will return true if
-    * dst_pdf is a CellDataFactory, false otherwise.
+    * dst_pdf is a CellDataFactory of TYPE or of the other floating point
+    * precision, false otherwise.
     *
     * @pre getDim() == dst_pdf->getDim()
     */
@@ -159,8 +177,20 @@ public:
    validCopyTo(
       const std::shared_ptr<hier::PatchDataFactory>& dst_pdf) const;
 
+   /**
+    * Return whether data of the supplied destination factory can unpack
+    * streams of this CellData, which is not the case for CellData of the
+    * other floating point precision.
+    *
+    * @pre getDim() == dst_pdf->getDim()
+    */
+   bool
+   validStreamTo(
+      const std::shared_ptr<hier::PatchDataFactory>& dst_pdf) const;
+
 private:
    int d_depth;
+   typename ArrayData<TYPE>::DepthLayout d_depth_layout;
 
 #if defined(HAVE_UMPIRE)
    umpire::Allocator d_allocator;
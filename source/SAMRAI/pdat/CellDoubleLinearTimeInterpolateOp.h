@@ -71,6 +71,46 @@ public:
       const hier::PatchData& src_data_old,
       const hier::PatchData& src_data_new) const;
 
+   /**
+    * Return true if the overlap has no rotation, so that time
+    * interpolation can be done over it straight into destination data
+    * or a message stream.
+    */
+   bool
+   canTimeInterpolateOverlap(
+      const hier::BoxOverlap& overlap) const;
+
+   /**
+    * Perform linear time interpolation between two cell-centered double
+    * patch data sources to the given time and place the result in the
+    * destination patch data over the overlap, as copying from patch data
+    * holding the interpolated values would.  No temporary patch data is
+    * used.
+    * @pre canTimeInterpolateOverlap(overlap)
+    */
+   void
+   timeInterpolateAndCopy(
+      hier::PatchData& dst_data,
+      const hier::BoxOverlap& overlap,
+      const hier::PatchData& src_data_old,
+      const hier::PatchData& src_data_new,
+      double time) const;
+
+   /**
+    * Perform linear time interpolation between two cell-centered double
+    * patch data sources to the given time and pack the result over the
+    * overlap into the stream, as packing patch data holding the
+    * interpolated values would.  No temporary patch data is used.
+    * @pre canTimeInterpolateOverlap(overlap)
+    */
+   void
+   timeInterpolateAndPack(
+      tbox::MessageStream& stream,
+      const hier::BoxOverlap& overlap,
+      const hier::PatchData& src_data_old,
+      const hier::PatchData& src_data_new,
+      double time) const;
+
 private:
 };
 
@@ -107,6 +107,15 @@ public:
    print(
       std::ostream& os) const;
 
+   /**
+    * Return a copy of this overlap with the destination boxes shifted
+    * and with the given transformation.
+    */
+   virtual std::shared_ptr<hier::BoxOverlap>
+   cloneShifted(
+      const hier::IntVector& shift,
+      const hier::Transformation& transformation) const;
+
 private:
    bool d_is_overlap_empty;
    hier::Transformation d_transformation;
@@ -0,0 +1,78 @@
+/*************************************************************************
+ *
+ * This file is part of the SAMRAI distribution.  For full copyright
+ * information, see COPYRIGHT and LICENSE.
+ *
+ * Copyright:     (c) 1997-2020 Lawrence Livermore National Security, LLC
+ * Description:   Coarsen operator for cell tag data on a mesh.
+ *
+ ************************************************************************/
+
+#ifndef included_pdat_CellTagCoarsen
+#define included_pdat_CellTagCoarsen
+
+#include "SAMRAI/SAMRAI_config.h"
+#include "SAMRAI/hier/Box.h"
+#include "SAMRAI/hier/IntVector.h"
+#include "SAMRAI/hier/Patch.h"
+#include "SAMRAI/hier/CoarsenOperator.h"
+
+namespace SAMRAI {
+namespace pdat {
+
+/**
+ * Class CellTagCoarsen coarsens CellTagData by tagging each coarse cell
+ * that covers a tagged fine cell, i.e. by OR of the fine tags.  It is
+ * derived from the hier::CoarsenOperator base class.
+ *
+ * @see hier::CoarsenOperator
+ * @see CellTagData
+ */
+
+class CellTagCoarsen:
+   public hier::CoarsenOperator
+{
+public:
+   /**
+    * Uninteresting default constructor.
+    */
+   CellTagCoarsen();
+
+   /**
+    * Uninteresting virtual destructor.
+    */
+   virtual ~CellTagCoarsen();
+
+   /**
+    * The priority of cell tag coarsening is 0.
+    * It will be performed before any user-defined coarsen operations.
+    */
+   int
+   getOperatorPriority() const;
+
+   /**
+    * The stencil width of the operator is the vector of zeros.  That is,
+    * its stencil does not extend outside the fine box.
+    */
+   hier::IntVector
+   getStencilWidth(
+      const tbox::Dimension& dim) const;
+
+   /**
+    * Coarsen the source component on the fine patch to the destination
+    * component on the coarse patch on the intersection of the destination
+    * patch and the coarse box.
+    */
+   void
+   coarsen(
+      hier::Patch& coarse,
+      const hier::Patch& fine,
+      const int dst_component,
+      const int src_component,
+      const hier::Box& coarse_box,
+      const hier::IntVector& ratio) const;
+};
+
+}
+}
+#endif
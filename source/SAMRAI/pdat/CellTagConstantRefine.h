@@ -0,0 +1,94 @@
+/*************************************************************************
+ *
+ * This file is part of the SAMRAI distribution.  For full copyright
+ * information, see COPYRIGHT and LICENSE.
+ *
+ * Copyright:     (c) 1997-2020 Lawrence Livermore National Security, LLC
+ * Description:   Constant refine operator for cell tag data on a mesh.
+ *
+ ************************************************************************/
+
+#ifndef included_pdat_CellTagConstantRefine
+#define included_pdat_CellTagConstantRefine
+
+#include "SAMRAI/SAMRAI_config.h"
+#include "SAMRAI/hier/Box.h"
+#include "SAMRAI/hier/IntVector.h"
+#include "SAMRAI/hier/Patch.h"
+#include "SAMRAI/hier/RefineOperator.h"
+
+namespace SAMRAI {
+namespace pdat {
+
+/**
+ * Class CellTagConstantRefine implements constant interpolation for
+ * CellTagData: each fine cell takes the tag of the coarse cell that
+ * covers it.  It is derived from the hier::RefineOperator base class.
+ *
+ * @see hier::RefineOperator
+ * @see CellTagData
+ */
+
+class CellTagConstantRefine:
+   public hier::RefineOperator
+{
+public:
+   /**
+    * Uninteresting default constructor.
+    */
+   CellTagConstantRefine();
+
+   /**
+    * Uninteresting virtual destructor.
+    */
+   virtual ~CellTagConstantRefine();
+
+   /**
+    * The priority of cell tag constant interpolation is 0.
+    * It will be performed before any user-defined interpolation operations.
+    */
+   int
+   getOperatorPriority() const;
+
+   /**
+    * The stencil width of the constant interpolation operator is the vector
+    * of zeros.  That is, its stencil does not extend outside the fine box.
+    */
+   hier::IntVector
+   getStencilWidth(
+      const tbox::Dimension& dim) const;
+
+   /**
+    * Refine the source component on the coarse patch to the destination
+    * component on the fine patch on the intersection of the destination
+    * patch and the boxes contained in fine_overlap.
+    *
+    * @pre dynamic_cast<const CellOverlap *>(&fine_overlap) != 0
+    */
+   void
+   refine(
+      hier::Patch& fine,
+      const hier::Patch& coarse,
+      const int dst_component,
+      const int src_component,
+      const hier::BoxOverlap& fine_overlap,
+      const hier::IntVector& ratio) const;
+
+   /**
+    * Refine the source component on the coarse patch to the destination
+    * component on the fine patch on the intersection of the destination
+    * patch and the fine box.
+    */
+   void
+   refine(
+      hier::Patch& fine,
+      const hier::Patch& coarse,
+      const int dst_component,
+      const int src_component,
+      const hier::Box& fine_box,
+      const hier::IntVector& ratio) const;
+};
+
+}
+}
+#endif
@@ -0,0 +1,458 @@
+/*************************************************************************
+ *
+ * This file is part of the SAMRAI distribution.  For full copyright
+ * information, see COPYRIGHT and LICENSE.
+ *
+ * Copyright:     (c) 1997-2020 Lawrence Livermore National Security, LLC
+ * Description:   Cell centered tags stored as one bit per cell
+ *
+ ************************************************************************/
+
+#ifndef included_pdat_CellTagData
+#define included_pdat_CellTagData
+
+#include "SAMRAI/SAMRAI_config.h"
+
+#include "SAMRAI/pdat/CellData.h"
+#include "SAMRAI/pdat/CellOverlap.h"
+#include "SAMRAI/hier/PatchData.h"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace SAMRAI {
+namespace pdat {
+
+/*!
+ * @brief Class CellTagData holds a boolean tag at the center of each cell
+ * of a patch, stored as one bit per cell.
+ *
+ * Cell tags mark cells to be refined.  Held as CellData<int>, they take
+ * 32 bits per cell in memory and in the messages that fill their ghost
+ * cells; CellTagData takes one.  The bits of each row of cells in the
+ * first direction of the ghost box are packed into whole 64-bit words,
+ * so that operations over a box work on a row at a time: fills and
+ * copies move words, counts use popcount, and rows may be combined with
+ * bitwise OR.
+ *
+ * Besides the hier::PatchData interface, the class provides the
+ * operations of gridding algorithms on tags: counting the tags in a box
+ * and accumulating their histograms along each direction (as in
+ * mesh::BergerRigoutsos), buffering tags by a given width (dilate()),
+ * and coarsening and refining them (coarsen() and refine(), also
+ * available as CellTagCoarsen and CellTagConstantRefine).
+ *
+ * Overlaps are computed with CellGeometry, so CellTagData is
+ * communicated like CellData.
+ *
+ * @see CellTagDataFactory
+ * @see CellTagVariable
+ * @see CellGeometry
+ */
+
+class CellTagData:public hier::PatchData
+{
+public:
+   /*!
+    * @brief Calculate the amount of memory needed to hold the tags of a
+    * box and its ghost cells.
+    *
+    * @pre box.getDim() == ghosts.getDim()
+    */
+   static size_t
+   getSizeOfData(
+      const hier::Box& box,
+      const hier::IntVector& ghosts);
+
+   /*!
+    * @brief Construct tag data over the box with the given ghost cell
+    * width.  All cells are untagged.
+    *
+    * @pre box.getDim() == ghosts.getDim()
+    * @pre ghosts.min() >= 0
+    */
+   CellTagData(
+      const hier::Box& box,
+      const hier::IntVector& ghosts);
+
+   /*!
+    * @brief The virtual destructor for a cell tag data object.
+    */
+   virtual ~CellTagData();
+
+   /*!
+    * @brief Return whether the cell is tagged.
+    *
+    * @pre getGhostBox().contains(i)
+    */
+   bool
+   isTagged(
+      const hier::Index& i) const
+   {
+      TBOX_ASSERT(getGhostBox().contains(i));
+      const size_t bit = static_cast<size_t>(i(0) - getGhostBox().lower(0));
+      return (getRow(i)[bit / BITS_PER_WORD] >> (bit % BITS_PER_WORD)) & 1;
+   }
+
+   /*!
+    * @brief Tag or untag the cell.
+    *
+    * @pre getGhostBox().contains(i)
+    */
+   void
+   setTag(
+      const hier::Index& i,
+      bool tag = true)
+   {
+      TBOX_ASSERT(getGhostBox().contains(i));
+      const size_t bit = static_cast<size_t>(i(0) - getGhostBox().lower(0));
+      const TagWord mask = TagWord(1) << (bit % BITS_PER_WORD);
+      TagWord& word = getRow(i)[bit / BITS_PER_WORD];
+      word = tag ? (word | mask) : (word & ~mask);
+   }
+
+   /*!
+    * @brief Tag or untag all cells of the box that lie in the ghost box.
+    *
+    * @pre getDim() == box.getDim()
+    */
+   void
+   fill(
+      bool tag,
+      const hier::Box& box);
+
+   /*!
+    * @brief Tag or untag all cells, including ghost cells.
+    */
+   void
+   fillAll(
+      bool tag);
+
+   /*!
+    * @brief Untag the tagged cells of the box and tag the others.
+    *
+    * @pre getDim() == box.getDim()
+    */
+   void
+   invert(
+      const hier::Box& box);
+
+   /*!
+    * @brief Tag the cells of the box whose value in the given cell data
+    * differs from untagged_value.  Other cells are left unchanged.
+    *
+    * @pre getDim() == values.getDim()
+    * @pre getDim() == box.getDim()
+    */
+   void
+   setTags(
+      const CellData<int>& values,
+      int untagged_value,
+      const hier::Box& box);
+
+   /*!
+    * @brief Return the number of tagged cells in the box.
+    *
+    * @pre getDim() == box.getDim()
+    */
+   size_t
+   getNumberOfTags(
+      const hier::Box& box) const;
+
+   /*!
+    * @brief Return whether any cell of the box is tagged.
+    *
+    * @pre getDim() == box.getDim()
+    */
+   bool
+   hasTags(
+      const hier::Box& box) const;
+
+   /*!
+    * @brief Add the tags in the box to histograms along each direction.
+    *
+    * For each direction d, histogram[d][i - origin(d)] is incremented
+    * by the number of tagged cells of the box with index i in
+    * direction d.  The row counts come from popcount; the histogram in
+    * the first direction visits each tag.
+    *
+    * @pre getDim() == box.getDim()
+    * @pre getGhostBox().contains(box)
+    * @pre histogram[d].size() covers the box for each direction d
+    */
+   void
+   accumulateHistograms(
+      std::vector<int> histogram[],
+      const hier::Box& box,
+      const hier::Index& origin) const;
+
+   /*!
+    * @brief Set the tags of the box to those of src buffered by width.
+    *
+    * A cell of the box is tagged if any tagged cell of src lies within
+    * width(d) cells of it in each direction d.  Only the tags of src
+    * within its ghost box are seen, so src should have ghost cells as
+    * wide as width, filled where the tags of neighboring patches are
+    * needed.  The directions are dilated one after the other, each
+    * combining whole rows of bits.
+    *
+    * @pre getDim() == src.getDim()
+    * @pre getDim() == box.getDim()
+    * @pre width >= hier::IntVector::getZero(getDim())
+    */
+   void
+   dilate(
+      const CellTagData& src,
+      const hier::Box& box,
+      const hier::IntVector& width);
+
+   /*!
+    * @brief Set the tags of coarse_box to the coarsened tags of fine.
+    *
+    * A coarse cell is tagged if any of the fine cells it covers that lie
+    * in the ghost box of fine is tagged.
+    *
+    * @pre getDim() == fine.getDim()
+    * @pre getDim() == coarse_box.getDim()
+    * @pre ratio > hier::IntVector::getZero(getDim())
+    */
+   void
+   coarsen(
+      const CellTagData& fine,
+      const hier::Box& coarse_box,
+      const hier::IntVector& ratio);
+
+   /*!
+    * @brief Set the tags of fine_box to those of the coarse cells that
+    * cover them.
+    *
+    * @pre getDim() == coarse.getDim()
+    * @pre getDim() == fine_box.getDim()
+    * @pre ratio > hier::IntVector::getZero(getDim())
+    * @pre coarse.getGhostBox().contains(hier::Box::coarsen(fine_box * getGhostBox(), ratio))
+    */
+   void
+   refine(
+      const CellTagData& coarse,
+      const hier::Box& fine_box,
+      const hier::IntVector& ratio);
+
+   /*!
+    * @brief A fast copy from source to destination (i.e., this) where
+    * their ghost boxes overlap.
+    *
+    * If the source is not CellTagData, src.copy2() is called.
+    *
+    * @pre getDim() == src.getDim()
+    */
+   virtual void
+   copy(
+      const hier::PatchData& src);
+
+   /*!
+    * @brief A fast copy from source (i.e., this) to destination where
+    * their ghost boxes overlap.
+    *
+    * @pre getDim() == dst.getDim()
+    * @pre dynamic_cast<CellTagData *>(&dst) != 0
+    */
+   virtual void
+   copy2(
+      hier::PatchData& dst) const;
+
+   /*!
+    * @brief Copy tags from source to destination (i.e., this) on the
+    * given CellOverlap, which may shift or rotate the source.
+    *
+    * If the source is not CellTagData or the overlap is not a
+    * CellOverlap, src.copy2() is called.
+    */
+   virtual void
+   copy(
+      const hier::PatchData& src,
+      const hier::BoxOverlap& overlap);
+
+   /*!
+    * @brief Copy tags from source (i.e., this) to destination on the
+    * given CellOverlap.
+    *
+    * @pre dynamic_cast<CellTagData *>(&dst) != 0
+    * @pre dynamic_cast<const CellOverlap *>(&overlap) != 0
+    */
+   virtual void
+   copy2(
+      hier::PatchData& dst,
+      const hier::BoxOverlap& overlap) const;
+
+   /*!
+    * @brief Return true since the stream size depends only on the
+    * overlap boxes.
+    */
+   virtual bool
+   canEstimateStreamSizeFromBox() const;
+
+   /*!
+    * @brief Return the number of bytes needed to stream the tags of the
+    * overlap, one bit per cell rounded up to whole words.
+    *
+    * @pre dynamic_cast<const CellOverlap *>(&overlap) != 0
+    */
+   virtual size_t
+   getDataStreamSize(
+      const hier::BoxOverlap& overlap) const;
+
+   /*!
+    * @brief Pack the tags of the overlap into the stream as bits.
+    *
+    * @pre dynamic_cast<const CellOverlap *>(&overlap) != 0
+    */
+   virtual void
+   packStream(
+      tbox::MessageStream& stream,
+      const hier::BoxOverlap& overlap) const;
+
+   /*!
+    * @brief Unpack the tags of the overlap from the stream.
+    *
+    * @pre dynamic_cast<const CellOverlap *>(&overlap) != 0
+    */
+   virtual void
+   unpackStream(
+      tbox::MessageStream& stream,
+      const hier::BoxOverlap& overlap);
+
+   /*!
+    * @brief Read the tags from the restart database.
+    *
+    * @pre restart_db
+    */
+   virtual void
+   getFromRestart(
+      const std::shared_ptr<tbox::Database>& restart_db);
+
+   /*!
+    * @brief Write the tags to the restart database.
+    *
+    * @pre restart_db
+    */
+   virtual void
+   putToRestart(
+      const std::shared_ptr<tbox::Database>& restart_db) const;
+
+private:
+   typedef uint64_t TagWord;
+
+   static const size_t BITS_PER_WORD = 64;
+
+   /*
+    * Static integer constant describing class's version number.
+    */
+   static const int PDAT_CELLTAGDATA_VERSION;
+
+   CellTagData(
+      const CellTagData&);             // not implemented
+   CellTagData&
+   operator = (
+      const CellTagData&);             // not implemented
+
+   /*
+    * Return the first word of the row of bits holding index i, whose
+    * first bit is the cell at getGhostBox().lower(0).
+    */
+   TagWord *
+   getRow(
+      const hier::Index& i)
+   {
+      return &d_words[getRowOffset(i)];
+   }
+
+   const TagWord *
+   getRow(
+      const hier::Index& i) const
+   {
+      return &d_words[getRowOffset(i)];
+   }
+
+   size_t
+   getRowOffset(
+      const hier::Index& i) const;
+
+   /*
+    * Copy the tags of src on box, shifted by -src_shift in src, which
+    * must lie in both ghost boxes.
+    */
+   void
+   copyOnBox(
+      const CellTagData& src,
+      const hier::Box& box,
+      const hier::IntVector& src_shift);
+
+   void
+   copyWithRotation(
+      const CellTagData& src,
+      const CellOverlap& overlap);
+
+   /*
+    * Primitives on rows of bits.  count is at most BITS_PER_WORD in
+    * getBits() and setBits().
+    */
+   static int
+   popCount(
+      TagWord word);
+
+   static int
+   countTrailingZeros(
+      TagWord word);
+
+   static TagWord
+   getBits(
+      const TagWord* row,
+      size_t first,
+      size_t count);
+
+   static void
+   setBits(
+      TagWord* row,
+      size_t first,
+      size_t count,
+      TagWord bits);
+
+   static void
+   copyBits(
+      TagWord* dst_row,
+      size_t dst_first,
+      const TagWord* src_row,
+      size_t src_first,
+      size_t count);
+
+   static void
+   fillBits(
+      TagWord* row,
+      size_t first,
+      size_t count,
+      bool tag);
+
+   static size_t
+   countBits(
+      const TagWord* row,
+      size_t first,
+      size_t count);
+
+   static bool
+   hasBits(
+      const TagWord* row,
+      size_t first,
+      size_t count);
+
+   /*
+    * Number of words in each row of the ghost box and the tag bits.
+    */
+   size_t d_words_per_row;
+   std::vector<TagWord> d_words;
+};
+
+}
+}
+
+#endif
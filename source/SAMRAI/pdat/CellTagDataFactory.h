@@ -0,0 +1,128 @@
+/*************************************************************************
+ *
+ * This file is part of the SAMRAI distribution.  For full copyright
+ * information, see COPYRIGHT and LICENSE.
+ *
+ * Copyright:     (c) 1997-2020 Lawrence Livermore National Security, LLC
+ * Description:   Factory class for creating cell tag data objects
+ *
+ ************************************************************************/
+
+#ifndef included_pdat_CellTagDataFactory
+#define included_pdat_CellTagDataFactory
+
+#include "SAMRAI/SAMRAI_config.h"
+
+#include "SAMRAI/hier/Box.h"
+#include "SAMRAI/hier/BoxGeometry.h"
+#include "SAMRAI/hier/IntVector.h"
+#include "SAMRAI/hier/PatchDataFactory.h"
+
+#include <memory>
+
+namespace SAMRAI {
+namespace pdat {
+
+/**
+ * Class CellTagDataFactory is a factory class used to allocate new
+ * instances of CellTagData objects.  It is a subclass of the patch data
+ * factory class.  Overlaps between cell tag data objects are computed
+ * with CellGeometry.
+ *
+ * @see CellTagData
+ * @see hier::PatchDataFactory
+ */
+
+class CellTagDataFactory:public hier::PatchDataFactory
+{
+public:
+   /**
+    * The default constructor for the cell tag data factory class.  The
+    * ghost cell width argument gives the default for all cell tag data
+    * objects created with this factory.
+    *
+    * @pre ghosts.min() >= 0
+    */
+   explicit CellTagDataFactory(
+      const hier::IntVector& ghosts);
+
+   /**
+    * Virtual destructor for the cell tag data factory class.
+    */
+   virtual ~CellTagDataFactory();
+
+   /**
+    * @brief Clone the factory with the given default ghost cell width.
+    *
+    * @pre getDim() == ghosts.getDim()
+    */
+   virtual std::shared_ptr<hier::PatchDataFactory>
+   cloneFactory(
+      const hier::IntVector& ghosts);
+
+   /**
+    * Virtual factory function to allocate a concrete cell tag data
+    * object, with no cells tagged.
+    *
+    * @pre getDim() == patch.getDim()
+    */
+   virtual std::shared_ptr<hier::PatchData>
+   allocate(
+      const hier::Patch& patch) const;
+
+   /**
+    * Allocate the cell box geometry object associated with the patch
+    * data.
+    *
+    * @pre getDim() == box.getDim()
+    */
+   virtual std::shared_ptr<hier::BoxGeometry>
+   getBoxGeometry(
+      const hier::Box& box) const;
+
+   /**
+    * Calculate the amount of memory needed to store the cell tag data
+    * object, including object data and dynamically allocated data.
+    *
+    * @pre getDim() == box.getDim()
+    */
+   virtual size_t
+   getSizeOfMemory(
+      const hier::Box& box) const;
+
+   /**
+    * Return true since cell tags, like cell data, are treated as though
+    * fine values represent them on coarse-fine interfaces.
+    */
+   bool
+   fineBoundaryRepresentsVariable() const;
+
+   /**
+    * Return false since cell tag data does not live on patch borders.
+    */
+   bool
+   dataLivesOnPatchBorder() const;
+
+   /**
+    * Return whether it is valid to copy this CellTagDataFactory to the
+    * supplied destination patch data factory, which is the case only for
+    * another CellTagDataFactory.
+    *
+    * @pre getDim() == dst_pdf->getDim()
+    */
+   bool
+   validCopyTo(
+      const std::shared_ptr<hier::PatchDataFactory>& dst_pdf) const;
+
+private:
+   CellTagDataFactory(
+      const CellTagDataFactory&);             // not implemented
+   CellTagDataFactory&
+   operator = (
+      const CellTagDataFactory&);             // not implemented
+};
+
+}
+}
+
+#endif
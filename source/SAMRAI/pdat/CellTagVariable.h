@@ -0,0 +1,76 @@
+/*************************************************************************
+ *
+ * This file is part of the SAMRAI distribution.  For full copyright
+ * information, see COPYRIGHT and LICENSE.
+ *
+ * Copyright:     (c) 1997-2020 Lawrence Livermore National Security, LLC
+ * Description:   Variable class for cell tags stored as one bit per cell
+ *
+ ************************************************************************/
+
+#ifndef included_pdat_CellTagVariable
+#define included_pdat_CellTagVariable
+
+#include "SAMRAI/SAMRAI_config.h"
+
+#include "SAMRAI/hier/Variable.h"
+
+#include <string>
+
+namespace SAMRAI {
+namespace pdat {
+
+/*!
+ * Class CellTagVariable is a variable class used to define boolean
+ * cell-centered tags on an AMR mesh, held in CellTagData.  Its data is
+ * refined with CellTagConstantRefine and coarsened with CellTagCoarsen.
+ *
+ * @see CellTagData
+ * @see CellTagDataFactory
+ * @see hier::Variable
+ */
+
+class CellTagVariable:public hier::Variable
+{
+public:
+   /*!
+    * @brief Create a cell tag variable object with the given name and
+    * no ghost cells.
+    */
+   CellTagVariable(
+      const tbox::Dimension& dim,
+      const std::string& name);
+
+   /*!
+    * @brief Virtual destructor for cell tag variable objects.
+    */
+   virtual ~CellTagVariable();
+
+   /*!
+    * @brief Return true since fine cell tags represent the tags on
+    * coarse-fine interfaces, as for cell data.
+    */
+   bool
+   fineBoundaryRepresentsVariable() const;
+
+   /*!
+    * @brief Return false since cell tags do not live on patch borders.
+    */
+   bool
+   dataLivesOnPatchBorder() const;
+
+private:
+   // Unimplemented copy constructor
+   CellTagVariable(
+      const CellTagVariable&);
+
+   // Unimplemented assignment operator
+   CellTagVariable&
+   operator = (
+      const CellTagVariable&);
+};
+
+}
+}
+
+#endif
@@ -14,6 +14,7 @@
 #include "SAMRAI/SAMRAI_config.h"
 
 #include "SAMRAI/hier/Variable.h"
+#include "SAMRAI/pdat/ArrayData.h"
 #include "SAMRAI/tbox/Complex.h"
 
 #include <string>
@@ -46,12 +47,16 @@ public:
    /*!
     * @brief Create a cell-centered variable object with the given name and
     * depth (i.e., number of data values at each cell index location).
-    * A default depth of one is provided.
+    * A default depth of one is provided.  The depth layout gives the
+    * arrangement in memory of the depth components of the cell data;
+    * see ArrayData.
     */
    CellVariable(
       const tbox::Dimension& dim,
       const std::string& name,
-      int depth = 1);
+      int depth = 1,
+      typename ArrayData<TYPE>::DepthLayout depth_layout =
+         ArrayData<TYPE>::PLANAR);
 
 #if defined(HAVE_UMPIRE)
    /*!
@@ -63,7 +68,9 @@ public:
       const tbox::Dimension& dim,
       const std::string& name,
       umpire::Allocator allocator,
-      int depth = 1);
+      int depth = 1,
+      typename ArrayData<TYPE>::DepthLayout depth_layout =
+         ArrayData<TYPE>::PLANAR);
 #endif
 
    /*!
@@ -0,0 +1,165 @@
+/*************************************************************************
+ *
+ * This file is part of the SAMRAI distribution.  For full copyright
+ * information, see COPYRIGHT and LICENSE.
+ *
+ * Copyright:     (c) 1997-2020 Lawrence Livermore National Security, LLC
+ * Description:   Access to array data through another arithmetic type
+ *
+ ************************************************************************/
+
+#ifndef included_pdat_ConvertingAccess
+#define included_pdat_ConvertingAccess
+
+#include "SAMRAI/SAMRAI_config.h"
+
+#include "SAMRAI/tbox/Utilities.h"
+
+#include <type_traits>
+#include <utility>
+
+namespace SAMRAI {
+namespace pdat {
+
+/*!
+ * @brief Reference to an array element of type TYPE that reads and
+ * writes values of type ACCESS_TYPE.
+ *
+ * Reads convert the stored value to ACCESS_TYPE and writes convert the
+ * assigned value back to TYPE, so that arithmetic on the element is
+ * done in ACCESS_TYPE.  TYPE may be const, in which case the reference
+ * is only read.
+ */
+template<class ACCESS_TYPE, class TYPE>
+class ConvertedReference
+{
+public:
+   SAMRAI_INLINE explicit ConvertedReference(
+      TYPE& element):
+      d_element(element)
+   {
+   }
+
+   SAMRAI_INLINE operator ACCESS_TYPE () const
+   {
+      return static_cast<ACCESS_TYPE>(d_element);
+   }
+
+   SAMRAI_INLINE const ConvertedReference&
+   operator = (
+      const ACCESS_TYPE& value) const
+   {
+      d_element = static_cast<typename std::remove_const<TYPE>::type>(value);
+      return *this;
+   }
+
+   SAMRAI_INLINE const ConvertedReference&
+   operator = (
+      const ConvertedReference& other) const
+   {
+      return *this = static_cast<ACCESS_TYPE>(other);
+   }
+
+   SAMRAI_INLINE const ConvertedReference&
+   operator += (
+      const ACCESS_TYPE& value) const
+   {
+      return *this = static_cast<ACCESS_TYPE>(*this) + value;
+   }
+
+   SAMRAI_INLINE const ConvertedReference&
+   operator -= (
+      const ACCESS_TYPE& value) const
+   {
+      return *this = static_cast<ACCESS_TYPE>(*this) - value;
+   }
+
+   SAMRAI_INLINE const ConvertedReference&
+   operator *= (
+      const ACCESS_TYPE& value) const
+   {
+      return *this = static_cast<ACCESS_TYPE>(*this) * value;
+   }
+
+private:
+   TYPE& d_element;
+};
+
+/*!
+ * @brief Adaptor presenting an accessor of array elements of one type
+ * as an accessor of elements of type ACCESS_TYPE.
+ *
+ * ACCESSOR is an ArrayView or an MDA_Access, or anything else whose
+ * operator() returns a reference to an element.  This lets a kernel
+ * written for double run on data stored as float, as with
+ *
+ * \verbatim
+ *
+ * CellData<float> data; // Assume this is allocated and initialized
+ *
+ * auto u = makeConvertingAccess<double>(data.getView<2>(0));
+ * // or ArrayDataAccess::accessAs<2, double>(data.getArrayData(), 0)
+ *
+ * pdat::CellIterator icend(pdat::CellGeometry::end(box));
+ * for (pdat::CellIterator ic(pdat::CellGeometry::begin(box));
+ *      ic != icend; ++ic) {
+ *    u((*ic)(0), (*ic)(1)) *= 0.5;
+ * }
+ *
+ * \endverbatim
+ *
+ * Each element is converted as it is accessed; nothing is copied.
+ */
+template<class ACCESS_TYPE, class ACCESSOR>
+class ConvertingAccess
+{
+public:
+   SAMRAI_INLINE explicit ConvertingAccess(
+      const ACCESSOR& accessor):
+      d_accessor(accessor)
+   {
+   }
+
+   template<class ... INDEX>
+   SAMRAI_INLINE ConvertedReference<ACCESS_TYPE,
+                                    typename std::remove_reference<
+                                       decltype(std::declval<const ACCESSOR&>()(
+                                                   std::declval<INDEX>() ...))>::type>
+   operator () (
+      INDEX ... index) const
+   {
+      typedef typename std::remove_reference<
+            decltype(d_accessor(index ...))>::type element_type;
+      return ConvertedReference<ACCESS_TYPE, element_type>(
+                d_accessor(index ...));
+   }
+
+   /*!
+    * @brief The wrapped accessor.
+    */
+   const ACCESSOR&
+   getAccessor() const
+   {
+      return d_accessor;
+   }
+
+private:
+   ACCESSOR d_accessor;
+};
+
+/*!
+ * @brief Wrap an accessor in a ConvertingAccess reading and writing
+ * ACCESS_TYPE.
+ */
+template<class ACCESS_TYPE, class ACCESSOR>
+SAMRAI_INLINE ConvertingAccess<ACCESS_TYPE, ACCESSOR>
+makeConvertingAccess(
+   const ACCESSOR& accessor)
+{
+   return ConvertingAccess<ACCESS_TYPE, ACCESSOR>(accessor);
+}
+
+}
+}
+
+#endif
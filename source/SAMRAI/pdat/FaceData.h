@@ -197,7 +197,6 @@ public:
       int face_normal,
       int depth = 0) const;
 
-#if defined(HAVE_RAJA)
   template <int DIM>
   using View = pdat::ArrayView<DIM, TYPE>;
 
@@ -205,17 +204,18 @@ public:
   using ConstView = pdat::ArrayView<DIM, const TYPE>;
 
    /*!
-    * @brief Get an ArrayView that can access the array for RAJA looping.
+    * @brief Get an ArrayView that can access the array in
+    * hier::parallel_for_all loops.
     */
   template <int DIM>
   View<DIM> getView(int face_normal, int depth = 0);
 
    /*!
-    * @brief Get a const ArrayView that can access the array for RAJA looping.
+    * @brief Get a const ArrayView that can access the array in
+    * hier::parallel_for_all loops.
     */
   template <int DIM>
   ConstView<DIM> getConstView(int face_normal, int depth = 0) const;
-#endif
 
    /*!
     * @brief Return a reference to the data entry corresponding
@@ -389,6 +389,42 @@ public:
       tbox::MessageStream& stream,
       const hier::BoxOverlap& overlap) const;
 
+   /*!
+    * @brief Set this patch data, over the overlap, to the linear time
+    * interpolation (1 - tfrac) * src_old + tfrac * src_new.
+    *
+    * The result is what copy() would give from FaceData holding the
+    * interpolated values, computed without such a temporary.
+    *
+    * @pre dynamic_cast<const FaceOverlap *>(&overlap) != 0
+    * @pre overlap.getTransformation().getRotation() ==
+    *      hier::Transformation::NO_ROTATE
+    */
+   void
+   linearTimeInterpolate(
+      const FaceData<TYPE>& src_old,
+      const FaceData<TYPE>& src_new,
+      double tfrac,
+      const hier::BoxOverlap& overlap);
+
+   /*!
+    * @brief Pack into the stream, over the overlap, the linear time
+    * interpolation (1 - tfrac) * (this data) + tfrac * src_new.
+    *
+    * The stream holds what packStream() would pack from FaceData holding
+    * the interpolated values, so it is unpacked with unpackStream().
+    *
+    * @pre dynamic_cast<const FaceOverlap *>(&overlap) != 0
+    * @pre overlap.getTransformation().getRotation() ==
+    *      hier::Transformation::NO_ROTATE
+    */
+   void
+   packStreamLinearTimeInterpolated(
+      tbox::MessageStream& stream,
+      const FaceData<TYPE>& src_new,
+      double tfrac,
+      const hier::BoxOverlap& overlap) const;
+
    /*!
     * @brief Unpack data from stream into this patch data object over
     * the specified box overlap region. The overlap must be an
@@ -604,7 +640,6 @@ private:
 
 };
 
-#if defined(HAVE_RAJA)
 template <int DIM, typename TYPE, typename... Args>
 typename FaceData<TYPE>::template View<DIM> get_view(FaceData<TYPE>& data,
                                                      Args&&... args);
@@ -613,7 +648,6 @@ template <int DIM, typename TYPE, typename... Args>
 typename FaceData<TYPE>::template ConstView<DIM> get_const_view(
     const FaceData<TYPE>& data,
     Args&&... args);
-#endif
 
 }
 }
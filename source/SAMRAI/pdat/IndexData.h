@@ -59,6 +59,30 @@ class IndexIterator;
  * updating the items stored, the "replace" versions are significantly
  * faster.
  *
+ * The description above is of the default LINKED_LIST storage policy,
+ * which allocates each item separately and keeps a pointer for every
+ * cell of the ghost box.  For sparse, particle-like data the CONTIGUOUS
+ * policy, chosen in the constructor or per variable through the
+ * IndexDataFactory, avoids both costs.  Items are stored by value in one
+ * array sorted by cell, and a compact index gives the range of the array
+ * holding each row of cells of the ghost box.  Items added in increasing
+ * cell order extend the sorted array directly; others are kept in a short
+ * unsorted tail that is merged in the next time the array is searched
+ * once it has grown too long, and always before an iteration or a
+ * box operation.  Copies, packing and removal over boxes are then scans
+ * of the ranges of the rows of the box.  With this policy:
+ *
+ *    - Iteration is in order of the cells, and the add and append
+ *      methods only differ for the LINKED_LIST policy.
+ *    - The "Pointer" insertion methods copy the item and delete the
+ *      pointer, so pointers given to IndexData must not be used after.
+ *    - Pointers returned by getItem() and iterators are invalidated when
+ *      items are added, and by the box removal methods.  removeItem()
+ *      does not move other items, so it may be used while iterating.
+ *    - TYPE must also have a copy constructor.
+ *    - The const query methods may reorder the storage, so one object
+ *      must not be queried from several threads at once.
+ *
  * The template parameter TYPE * defines the storage at each index
  * location.  IndexData is derived from * hier::PatchData.
  *
@@ -108,6 +132,20 @@ public:
     */
    typedef IndexIterator<TYPE, BOX_GEOMETRY> iterator;
 
+   /**
+    * Ways of storing the items.  See the class description.
+    *
+    *    - \b LINKED_LIST - separately allocated items in a linked list
+    *                       in insertion order, found through a pointer
+    *                       per cell.
+    *    - \b CONTIGUOUS  - items by value in an array sorted by cell,
+    *                       found through a row index.
+    */
+   enum StoragePolicy {
+      LINKED_LIST,
+      CONTIGUOUS
+   };
+
    /**
     * The constructor for an IndexData object.  The box describes the interior
     * of the index space and the ghosts vector describes the ghost nodes in
@@ -117,13 +155,23 @@ public:
     */
    IndexData(
       const hier::Box& box,
-      const hier::IntVector& ghosts);
+      const hier::IntVector& ghosts,
+      StoragePolicy storage_policy = LINKED_LIST);
 
    /**
     * The virtual destructor for an IndexData object.
     */
    virtual ~IndexData<TYPE, BOX_GEOMETRY>();
 
+   /**
+    * Return the storage policy of this object.
+    */
+   StoragePolicy
+   getStoragePolicy() const
+   {
+      return d_storage_policy;
+   }
+
    /**
     * A fast copy between the source and destination.  All data is copied
     * from the source into the destination where there is overlap in the
@@ -464,6 +512,36 @@ private:
     */
    static const int PDAT_INDEXDATA_VERSION;
 
+   /*
+    * Length of the unsorted tail of the CONTIGUOUS storage searched
+    * linearly before it is merged into the sorted items, when the
+    * sorted items are fewer than its square.
+    */
+   static const size_t MIN_UNSORTED_ITEMS;
+
+   /*
+    * An item of the CONTIGUOUS storage policy, with its index and its
+    * offset in the ghost box.  Removed items stay, marked, until the
+    * storage is next compacted, so that removal does not move items.
+    */
+   struct Entry {
+      Entry(
+         const hier::Index& index,
+         size_t offset,
+         const TYPE& item):
+         d_index(index),
+         d_offset(offset),
+         d_removed(false),
+         d_item(item)
+      {
+      }
+
+      hier::Index d_index;
+      size_t d_offset;
+      bool d_removed;
+      TYPE d_item;
+   };
+
    /**
     * Returns true if element exists at offset
     */
@@ -519,6 +597,79 @@ private:
    removeNodeFromList(
       IndexDataNode<TYPE, BOX_GEOMETRY> * node);
 
+   /**
+    * Add an item to the CONTIGUOUS storage.  An existing item at the
+    * same offset is superseded; it is dropped when the storage is sorted.
+    */
+   void
+   addEntry(
+      const hier::Index& index,
+      const size_t offset,
+      const TYPE& item);
+
+   /**
+    * Add the entry at the end of the sorted CONTIGUOUS storage, in the
+    * given row of the ghost box, to the row index.
+    */
+   void
+   addToRowIndex(
+      size_t row) const;
+
+   /**
+    * Return the position of the CONTIGUOUS storage entry holding the
+    * item at the offset, or -1 if there is no item there.
+    */
+   int
+   findEntry(
+      size_t offset) const;
+
+   /**
+    * Merge the unsorted tail of the CONTIGUOUS storage into the sorted
+    * entries, dropping removed and superseded entries, and rebuild the
+    * row index.  Does nothing if there is no unsorted tail.
+    */
+   void
+   sortEntries() const;
+
+   /**
+    * Drop the removed entries of the sorted CONTIGUOUS storage.
+    */
+   void
+   compactEntries();
+
+   /**
+    * Return the position of the next (or previous) entry of the
+    * CONTIGUOUS storage that is not removed, or -1 if there is none.
+    */
+   int
+   getNextEntry(
+      int position) const;
+   int
+   getPreviousEntry(
+      int position) const;
+
+   /**
+    * Call body(index, item) for each item whose index is in the box, in
+    * the order of the list or of the cells.
+    */
+   template<class BODY>
+   void
+   forItemsInBox(
+      const hier::Box& box,
+      BODY body) const;
+
+   /**
+    * Call body(position) for the position of each entry of the sorted
+    * CONTIGUOUS storage whose index is in the box, in order.
+    *
+    * @pre the storage has no unsorted tail
+    */
+   template<class BODY>
+   void
+   forEntriesInBox(
+      const hier::Box& box,
+      BODY body) const;
+
    // Unimplemented copy constructor
    IndexData(
       const IndexData&);
@@ -530,6 +681,11 @@ private:
 
    const tbox::Dimension d_dim;
 
+   const StoragePolicy d_storage_policy;
+
+   /*
+    * LINKED_LIST storage: the node of each cell of the ghost box.
+    */
    std::vector<IndexDataNode<TYPE, BOX_GEOMETRY> *> d_data;
 
    /*
@@ -538,6 +694,21 @@ private:
    IndexDataNode<TYPE, BOX_GEOMETRY>* d_list_head;
    IndexDataNode<TYPE, BOX_GEOMETRY>* d_list_tail;
    int d_number_items;
+
+   /*
+    * CONTIGUOUS storage.  The first d_num_sorted entries are in
+    * increasing offset order, followed by the unsorted tail.  Entries
+    * d_row_begin[r] to d_row_begin[r+1] of the sorted ones are in row r
+    * of the ghost box, a row being the cells with the same indices in
+    * every direction but the first.  Rows from d_row_begin.size()-1 on
+    * have no sorted entries.  These are rearranged by sortEntries(),
+    * which the const queries call.
+    */
+   mutable std::vector<Entry> d_entries;
+   mutable std::vector<int> d_row_begin;
+   mutable size_t d_num_sorted;
+   mutable size_t d_num_removed;
+   size_t d_row_length;
 };
 
 /**
@@ -712,6 +883,11 @@ private:
    IndexData<TYPE, BOX_GEOMETRY>* d_index_data;
 
    IndexDataNode<TYPE, BOX_GEOMETRY>* d_node;
+
+   /*
+    * Position in the CONTIGUOUS storage, or -1.
+    */
+   int d_position;
 };
 
 }
@@ -18,6 +18,7 @@
 #include "SAMRAI/hier/Patch.h"
 #include "SAMRAI/hier/PatchData.h"
 #include "SAMRAI/hier/PatchDataFactory.h"
+#include "SAMRAI/pdat/IndexData.h"
 
 #include <memory>
 
@@ -27,7 +28,8 @@ namespace pdat {
 /**
  * Class IndexDataFactory<TYPE, BOX_GEOMETRY> is the factory class used to
  * allocate new instances of IndexData<TYPE, BOX_GEOMETRY> objects.  It is a
- * subclass of the hier::PatchDataFactory base class.
+ * subclass of the hier::PatchDataFactory base class.  The storage policy
+ * of the objects created is set per factory, and so per variable.
  *
  * @see IndexData
  * @see IndexVariable
@@ -41,16 +43,28 @@ public:
    /**
     * The default constructor for the IndexDataFactory<TYPE, BOX_GEOMETRY>
     * class.  The ghost cell width argument gives the default width for all
-    * irregular data objects created with this factory.
+    * irregular data objects created with this factory, and the storage
+    * policy argument the way they store their items.
     */
    explicit IndexDataFactory(
-      const hier::IntVector& ghosts);
+      const hier::IntVector& ghosts,
+      typename IndexData<TYPE, BOX_GEOMETRY>::StoragePolicy storage_policy =
+         IndexData<TYPE, BOX_GEOMETRY>::LINKED_LIST);
 
    /**
     * Virtual destructor for the irregular data factory class.
     */
    virtual ~IndexDataFactory<TYPE, BOX_GEOMETRY>();
 
+   /**
+    * Return the storage policy of the index data objects created.
+    */
+   typename IndexData<TYPE, BOX_GEOMETRY>::StoragePolicy
+   getStoragePolicy() const
+   {
+      return d_storage_policy;
+   }
+
    /**
     * @brief Abstract virtual function to clone a patch data factory.
     *
@@ -138,6 +152,7 @@ private:
    operator = (
       const IndexDataFactory&);
 
+   typename IndexData<TYPE, BOX_GEOMETRY>::StoragePolicy d_storage_policy;
 };
 
 }
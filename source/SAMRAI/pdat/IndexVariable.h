@@ -15,6 +15,7 @@
 
 #include "SAMRAI/hier/IntVector.h"
 #include "SAMRAI/hier/Variable.h"
+#include "SAMRAI/pdat/IndexData.h"
 
 #include <string>
 
@@ -46,11 +47,14 @@ class IndexVariable:public hier::Variable
 {
 public:
    /**
-    * Create an index variable object with the specified name.
+    * Create an index variable object with the specified name.  Its
+    * patch data store their items with the given storage policy.
     */
    IndexVariable(
       const tbox::Dimension& dim,
-      const std::string& name);
+      const std::string& name,
+      typename IndexData<TYPE, BOX_GEOMETRY>::StoragePolicy storage_policy =
+         IndexData<TYPE, BOX_GEOMETRY>::LINKED_LIST);
 
    /**
     * Virtual destructor for index variable objects.
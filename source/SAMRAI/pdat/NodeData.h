@@ -106,6 +106,8 @@ public:
     * @param ghosts const IntVector reference indicating the width
     *              of the ghost cell region around the box over which
     *              the node data will be allocated.
+    * @param depth_layout how the depth components are arranged in memory;
+    *              see ArrayData.
     *
     * @pre box.getDim() == ghosts.getDim()
     * @pre depth > 0
@@ -114,7 +116,9 @@ public:
    NodeData(
       const hier::Box& box,
       int depth,
-      const hier::IntVector& ghosts);
+      const hier::IntVector& ghosts,
+      typename ArrayData<TYPE>::DepthLayout depth_layout =
+         ArrayData<TYPE>::PLANAR);
 
 #if defined(HAVE_UMPIRE)
    /*!
@@ -130,6 +134,8 @@ public:
     *               the node data will be allocated.
     * @param allocator An Umpire allocator to manage the allocation of the
     *                  underlying data.
+    * @param depth_layout how the depth components are arranged in memory;
+    *              see ArrayData.
     *
     * @pre box.getDim() == ghosts.getDim()
     * @pre depth > 0
@@ -139,7 +145,9 @@ public:
       const hier::Box& box,
       int depth,
       const hier::IntVector& ghosts,
-      umpire::Allocator allocator);
+      umpire::Allocator allocator,
+      typename ArrayData<TYPE>::DepthLayout depth_layout =
+         ArrayData<TYPE>::PLANAR);
 #endif
 
 
@@ -156,6 +164,15 @@ public:
    int
    getDepth() const;
 
+   /*!
+    * @brief Return how the depth components are arranged in memory.
+    */
+   typename ArrayData<TYPE>::DepthLayout
+   getDepthLayout() const
+   {
+      return d_data->getDepthLayout();
+   }
+
    /*!
     * @brief Get a pointer to the beginning of a particular depth
     * component of the node centered array.
@@ -176,7 +193,6 @@ public:
    getPointer(
       int depth = 0) const;
 
-#if defined(HAVE_RAJA)
    template<int DIM>
    using View = pdat::ArrayView<DIM, TYPE>;
 
@@ -184,7 +200,13 @@ public:
    using ConstView = pdat::ArrayView<DIM, const TYPE>;
 
    /*!
-    * @brief Get an ArrayView that can access the array for RAJA looping.
+    * @brief Get an ArrayView that can access the array in
+    * hier::parallel_for_all loops.
+    *
+    * The view has the strides of ArrayData::getPaddedBox(), which
+    * differ from those of the ghost box for the ArrayData::PADDED
+    * layout.  Views are not available for the ArrayData::INTERLEAVED
+    * layout.
     */
    template <int DIM>
    View<DIM>
@@ -192,13 +214,18 @@ public:
       int depth = 0);
 
    /*!
-    * @brief Get a const ArrayView that can access the array for RAJA looping.
+    * @brief Get a const ArrayView that can access the array in
+    * hier::parallel_for_all loops.
+    *
+    * The view has the strides of ArrayData::getPaddedBox(), which
+    * differ from those of the ghost box for the ArrayData::PADDED
+    * layout.  Views are not available for the ArrayData::INTERLEAVED
+    * layout.
     */
    template <int DIM>
    ConstView<DIM>
    getConstView(
       int depth = 0) const;
-#endif
 
    /*!
     * @brief Return a reference to the data entry corresponding
@@ -364,6 +391,42 @@ public:
       tbox::MessageStream& stream,
       const hier::BoxOverlap& overlap) const;
 
+   /*!
+    * @brief Set this patch data, over the overlap, to the linear time
+    * interpolation (1 - tfrac) * src_old + tfrac * src_new.
+    *
+    * The result is what copy() would give from NodeData holding the
+    * interpolated values, computed without such a temporary.
+    *
+    * @pre dynamic_cast<const NodeOverlap *>(&overlap) != 0
+    * @pre overlap.getTransformation().getRotation() ==
+    *      hier::Transformation::NO_ROTATE
+    */
+   void
+   linearTimeInterpolate(
+      const NodeData<TYPE>& src_old,
+      const NodeData<TYPE>& src_new,
+      double tfrac,
+      const hier::BoxOverlap& overlap);
+
+   /*!
+    * @brief Pack into the stream, over the overlap, the linear time
+    * interpolation (1 - tfrac) * (this data) + tfrac * src_new.
+    *
+    * The stream holds what packStream() would pack from NodeData holding
+    * the interpolated values, so it is unpacked with unpackStream().
+    *
+    * @pre dynamic_cast<const NodeOverlap *>(&overlap) != 0
+    * @pre overlap.getTransformation().getRotation() ==
+    *      hier::Transformation::NO_ROTATE
+    */
+   void
+   packStreamLinearTimeInterpolated(
+      tbox::MessageStream& stream,
+      const NodeData<TYPE>& src_new,
+      double tfrac,
+      const hier::BoxOverlap& overlap) const;
+
    /*!
     * @brief Unpack data from stream into this patch data object over
     * the specified box overlap region. The overlap must be a
@@ -538,13 +601,11 @@ private:
 
 };
 
-#if defined(HAVE_RAJA)
 template<int DIM, typename TYPE, typename... Args>
 typename NodeData<TYPE>::template View<DIM> get_view(NodeData<TYPE>& data, Args&&... args);
 
 template<int DIM, typename TYPE, typename... Args>
 typename NodeData<TYPE>::template ConstView<DIM> get_const_view(const NodeData<TYPE>& data, Args&&... args);
-#endif
 
 }
 }
@@ -17,6 +17,7 @@
 #include "SAMRAI/hier/BoxGeometry.h"
 #include "SAMRAI/hier/IntVector.h"
 #include "SAMRAI/hier/PatchDataFactory.h"
+#include "SAMRAI/pdat/ArrayData.h"
 #include "SAMRAI/tbox/Complex.h"
 
 #include <memory>
@@ -48,6 +49,8 @@ public:
     * depth (number of components), and fine boundary representation arguments
     * give the defaults for all edge data objects created with this factory.
     * See the NodeVariable<TYPE> class header file for more information.
+    * The depth layout argument gives the arrangement of the depth
+    * components in memory; see ArrayData.
     *
     * @pre depth > 0
     * @pre ghosts.min() >= 0
@@ -55,7 +58,9 @@ public:
    NodeDataFactory(
       int depth,
       const hier::IntVector& ghosts,
-      bool fine_boundary_represents_var);
+      bool fine_boundary_represents_var,
+      typename ArrayData<TYPE>::DepthLayout depth_layout =
+         ArrayData<TYPE>::PLANAR);
 
 #if defined(HAVE_UMPIRE)
    /**
@@ -70,7 +75,9 @@ public:
       int depth,
       const hier::IntVector& ghosts,
       bool fine_boundary_represents_var,
-      umpire::Allocator allocator);
+      umpire::Allocator allocator,
+      typename ArrayData<TYPE>::DepthLayout depth_layout =
+         ArrayData<TYPE>::PLANAR);
 #endif
 
 
@@ -125,6 +132,16 @@ public:
    int
    getDepth() const;
 
+   /**
+    * Get the arrangement in memory of the depth components of the data
+    * objects created by this factory.
+    */
+   typename ArrayData<TYPE>::DepthLayout
+   getDepthLayout() const
+   {
+      return d_depth_layout;
+   }
+
    /**
     * Calculate the amount of memory needed to store the node data object,
     * including object data and dynamically allocated data.
@@ -165,6 +182,7 @@ public:
 private:
    int d_depth;
    bool d_fine_boundary_represents_var;
+   typename ArrayData<TYPE>::DepthLayout d_depth_layout;
 
 #if defined(HAVE_UMPIRE)
    umpire::Allocator d_allocator;
@@ -158,6 +158,14 @@ public:
       const hier::BoxContainer& boxes,
       const hier::Transformation& transformation) const;
 
+   /*!
+    * @brief Append the box and ghost width to an overlap cache key.
+    */
+   virtual bool
+   getOverlapCacheKey(
+      std::vector<int>& key,
+      hier::Index& origin) const;
+
    /*!
     * @brief Return the box for this node centered box geometry
     * object.
@@ -18,6 +18,8 @@
 #include "SAMRAI/hier/BoxOverlap.h"
 #include "SAMRAI/hier/IntVector.h"
 
+#include <memory>
+
 
 namespace SAMRAI {
 namespace pdat {
@@ -92,6 +94,15 @@ public:
    virtual const hier::Transformation&
    getTransformation() const;
 
+   /**
+    * Return a copy of this overlap with the destination boxes shifted
+    * and with the given transformation.
+    */
+   virtual std::shared_ptr<hier::BoxOverlap>
+   cloneShifted(
+      const hier::IntVector& shift,
+      const hier::Transformation& transformation) const;
+
 private:
    bool d_is_overlap_empty;
    hier::Transformation d_transformation;
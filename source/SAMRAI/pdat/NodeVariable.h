@@ -14,6 +14,7 @@
 #include "SAMRAI/SAMRAI_config.h"
 
 #include "SAMRAI/hier/Variable.h"
+#include "SAMRAI/pdat/ArrayData.h"
 #include "SAMRAI/tbox/Complex.h"
 
 #include <string>
@@ -46,13 +47,16 @@ public:
     * boolean argument indicates which values (either coarse or fine) take
     * precedence at coarse-fine mesh boundaries during coarsen and refine
     * operations.  The default is that fine data values take precedence
-    * on coarse-fine interfaces.
+    * on coarse-fine interfaces.  The depth layout gives the arrangement in
+    * memory of the depth components of the node data; see ArrayData.
     */
    NodeVariable(
       const tbox::Dimension& dim,
       const std::string& name,
       int depth = 1,
-      bool fine_boundary_represents_var = true);
+      bool fine_boundary_represents_var = true,
+      typename ArrayData<TYPE>::DepthLayout depth_layout =
+         ArrayData<TYPE>::PLANAR);
 
    /*!
     * @brief Virtual destructor for node variable objects.
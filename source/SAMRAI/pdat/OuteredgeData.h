@@ -290,7 +290,6 @@ public:
       int side,
       int depth = 0) const;
 
-#if defined(HAVE_RAJA)
    template <int DIM>
    using View = pdat::ArrayView<DIM, TYPE>;
 
@@ -298,17 +297,18 @@ public:
    using ConstView = pdat::ArrayView<DIM, const TYPE>;
 
    /*!
-    * @brief Get an ArrayView that can access the array for RAJA looping.
+    * @brief Get an ArrayView that can access the array in
+    * hier::parallel_for_all loops.
     */
    template <int DIM>
    View<DIM> getView(int axis, int face_normal, int side, int depth = 0);
 
    /*!
-    * @brief Get a const ArrayView that can access the array for RAJA looping.
+    * @brief Get a const ArrayView that can access the array in
+    * hier::parallel_for_all loops.
     */
    template <int DIM>
    ConstView<DIM> getConstView(int axis, int face_normal, int side, int depth = 0) const;
-#endif
 
    /*!
     * @brief Return a reference to data entry corresponding
@@ -800,7 +800,6 @@ private:
    d_data[SAMRAI::MAX_DIM_VAL][SAMRAI::MAX_DIM_VAL][2];
 };
 
-#if defined(HAVE_RAJA)
 template <int DIM, typename TYPE, typename... Args>
 typename OuteredgeData<TYPE>::template View<DIM> get_view(OuteredgeData<TYPE>& data,
                                                      Args&&... args);
@@ -809,7 +808,6 @@ template <int DIM, typename TYPE, typename... Args>
 typename OuteredgeData<TYPE>::template ConstView<DIM> get_const_view(
     const OuteredgeData<TYPE>& data,
     Args&&... args);
-#endif
 
 }
 }
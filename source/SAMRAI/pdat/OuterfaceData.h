@@ -201,7 +201,6 @@ public:
       int side,
       int depth = 0) const;
 
-#if defined(HAVE_RAJA)
    template <int DIM>
    using View = pdat::ArrayView<DIM, TYPE>;
 
@@ -209,17 +208,18 @@ public:
    using ConstView = pdat::ArrayView<DIM, const TYPE>;
 
    /*!
-    * @brief Get an ArrayView that can access the array for RAJA looping.
+    * @brief Get an ArrayView that can access the array in
+    * hier::parallel_for_all loops.
     */
    template <int DIM>
    View<DIM> getView(int face_normal, int side, int depth = 0);
  
    /*!
-    * @brief Get a const ArrayView that can access the array for RAJA looping.
+    * @brief Get a const ArrayView that can access the array in
+    * hier::parallel_for_all loops.
     */
    template <int DIM>
    ConstView<DIM> getConstView(int face_normal, int side, int depth = 0) const;
-#endif
 
    /*!
     * @brief Return a reference to data entry corresponding
@@ -621,7 +621,6 @@ private:
    std::shared_ptr<ArrayData<TYPE> > d_data[SAMRAI::MAX_DIM_VAL][2];
 };
 
-#if defined(HAVE_RAJA)
 template <int DIM, typename TYPE, typename... Args>
 typename OuterfaceData<TYPE>::template View<DIM> get_view(OuterfaceData<TYPE>& data,
                                                      Args&&... args);
@@ -630,7 +629,6 @@ template <int DIM, typename TYPE, typename... Args>
 typename OuterfaceData<TYPE>::template ConstView<DIM> get_const_view(
     const OuterfaceData<TYPE>& data,
     Args&&... args);
-#endif
 
 
 }
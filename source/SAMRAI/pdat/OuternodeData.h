@@ -242,7 +242,6 @@ public:
       int side,
       int depth = 0) const;
 
-#if defined(HAVE_RAJA)
    template <int DIM>
    using View = pdat::ArrayView<DIM, TYPE>;
 
@@ -250,17 +249,18 @@ public:
    using ConstView = pdat::ArrayView<DIM, const TYPE>;
 
    /*!
-    * @brief Get an ArrayView that can access the array for RAJA looping.
+    * @brief Get an ArrayView that can access the array in
+    * hier::parallel_for_all loops.
     */
    template <int DIM>
    View<DIM> getView(int face_normal, int side, int depth = 0);
 
    /*!
-    * @brief Get a const ArrayView that can access the array for RAJA looping.
+    * @brief Get a const ArrayView that can access the array in
+    * hier::parallel_for_all loops.
     */
    template <int DIM>
    ConstView<DIM> getConstView(int face_normal, int side, int depth = 0) const;
-#endif
 
    /*!
     * @brief Return a reference to data entry corresponding
@@ -725,7 +725,6 @@ private:
 };
 
 
-#if defined(HAVE_RAJA)
 template <int DIM, typename TYPE, typename... Args>
 typename OuternodeData<TYPE>::template View<DIM> get_view(OuternodeData<TYPE>& data,
                                                      Args&&... args);
@@ -734,7 +733,6 @@ template <int DIM, typename TYPE, typename... Args>
 typename OuternodeData<TYPE>::template ConstView<DIM> get_const_view(
     const OuternodeData<TYPE>& data,
     Args&&... args);
-#endif
 
 
 }
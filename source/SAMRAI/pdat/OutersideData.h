@@ -200,7 +200,6 @@ public:
       int side,
       int depth = 0) const;
 
-#if defined(HAVE_RAJA)
    template <int DIM>
    using View = pdat::ArrayView<DIM, TYPE>;
 
@@ -208,17 +207,18 @@ public:
    using ConstView = pdat::ArrayView<DIM, const TYPE>;
 
    /*!
-    * @brief Get an ArrayView that can access the array for RAJA looping.
+    * @brief Get an ArrayView that can access the array in
+    * hier::parallel_for_all loops.
     */
    template <int DIM>
    View<DIM> getView(int side_normal, int side, int depth = 0);
 
    /*!
-    * @brief Get an ArrayView that can access the array for RAJA looping.
+    * @brief Get an ArrayView that can access the array in
+    * hier::parallel_for_all loops.
     */
    template <int DIM>
    ConstView<DIM> getConstView(int side_normal, int side, int depth = 0) const;
-#endif
 
    /*!
     * @brief Return a reference to data entry corresponding
@@ -615,7 +615,6 @@ private:
    std::shared_ptr<ArrayData<TYPE> > d_data[SAMRAI::MAX_DIM_VAL][2];
 };
 
-#if defined(HAVE_RAJA)
 template <int DIM, typename TYPE, typename... Args>
 typename OutersideData<TYPE>::template View<DIM> get_view(OutersideData<TYPE>& data,
                                                      Args&&... args);
@@ -624,7 +623,6 @@ template <int DIM, typename TYPE, typename... Args>
 typename OutersideData<TYPE>::template ConstView<DIM> get_const_view(
     const OutersideData<TYPE>& data,
     Args&&... args);
-#endif
 
 
 }
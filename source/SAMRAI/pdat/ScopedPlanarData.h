@@ -0,0 +1,126 @@
+/*************************************************************************
+ *
+ * This file is part of the SAMRAI distribution.  For full copyright
+ * information, see COPYRIGHT and LICENSE.
+ *
+ * Copyright:     (c) 1997-2020 Lawrence Livermore National Security, LLC
+ * Description:   Planar copy of interleaved or padded patch data for
+ *                the length of a scope
+ *
+ ************************************************************************/
+
+#ifndef included_pdat_ScopedPlanarData
+#define included_pdat_ScopedPlanarData
+
+#include "SAMRAI/SAMRAI_config.h"
+
+#include "SAMRAI/hier/Box.h"
+#include "SAMRAI/pdat/CellData.h"
+#include "SAMRAI/pdat/NodeData.h"
+#include "SAMRAI/pdat/SideData.h"
+
+#include <memory>
+
+namespace SAMRAI {
+namespace pdat {
+
+/*!
+ * @brief Replace patch data in the ArrayData::INTERLEAVED or
+ * ArrayData::PADDED layout by a planar copy for the length of a scope.
+ *
+ * The Fortran kernels and the ArrayView loops of the refine, coarsen and
+ * time interpolation operators address the depth components as separate
+ * planes dimensioned by the ghost box.  An operator that receives data
+ * in another layout constructs a ScopedPlanarData for each operand.
+ * The shared pointer given to the constructor is pointed to a new
+ * planar object over the part of the ghost box of the data inside the
+ * given cell box, holding a copy of the data there, so that the rest of
+ * the operator runs unchanged.  The destructor copies the planar values
+ * back if the operand is written and restores the pointer.
+ *
+ * Data for which ArrayData::isPlanar() holds is left alone and costs
+ * nothing.
+ *
+ * DATA is CellData, NodeData or SideData of some type.
+ */
+template<class DATA>
+class ScopedPlanarData
+{
+public:
+   /*!
+    * @brief Stage the data if it is interleaved.
+    *
+    * @param[in,out] data  Pointer to the data, redirected to the planar
+    *                      copy until the destructor runs.
+    * @param[in] box  Cell box of the region used by the operator.
+    * @param[in] write_back  Whether the operator writes the data, in which
+    *                        case the values in the region are copied back.
+    */
+   ScopedPlanarData(
+      std::shared_ptr<DATA>& data,
+      const hier::Box& box,
+      bool write_back = false);
+
+   /*!
+    * @brief Stage all of the data if it is interleaved.
+    *
+    * @param[in,out] data  Pointer to the data, redirected to the planar
+    *                      copy until the destructor runs.
+    * @param[in] write_back  Whether the operator writes the data.
+    */
+   explicit ScopedPlanarData(
+      std::shared_ptr<DATA>& data,
+      bool write_back = false);
+
+   /*!
+    * @brief Copy the values back if requested and restore the pointer.
+    */
+   ~ScopedPlanarData();
+
+private:
+   // Unimplemented copy constructor.
+   ScopedPlanarData(
+      const ScopedPlanarData&);
+
+   // Unimplemented assignment operator.
+   ScopedPlanarData&
+   operator = (
+      const ScopedPlanarData&);
+
+   /*
+    * Return a planar object over the box, or null if the data is
+    * already laid out as the operators expect.
+    */
+   template<class TYPE>
+   static std::shared_ptr<CellData<TYPE> >
+   createPlanarData(
+      const CellData<TYPE>& data,
+      const hier::Box& box);
+
+   template<class TYPE>
+   static std::shared_ptr<NodeData<TYPE> >
+   createPlanarData(
+      const NodeData<TYPE>& data,
+      const hier::Box& box);
+
+   template<class TYPE>
+   static std::shared_ptr<SideData<TYPE> >
+   createPlanarData(
+      const SideData<TYPE>& data,
+      const hier::Box& box);
+
+   void
+   stage(
+      const hier::Box& box);
+
+   std::shared_ptr<DATA>& d_data;
+   std::shared_ptr<DATA> d_original;
+   bool d_write_back;
+};
+
+}
+}
+
+#include "SAMRAI/pdat/ScopedPlanarData.C"
+
+#endif
@@ -137,6 +137,8 @@ public:
     * @param directions const IntVector reference indicating which
     *                   coordinate directions will have data associated
     *                   with them.
+    * @param depth_layout how the depth components are arranged in memory;
+    *              see ArrayData.
     *
     * @pre (box.getDim() == ghosts.getDim()) &&
     *      (box.getDim() == directions.getDim())
@@ -148,7 +150,9 @@ public:
       const hier::Box& box,
       int depth,
       const hier::IntVector& ghosts,
-      const hier::IntVector& directions);
+      const hier::IntVector& directions,
+      typename ArrayData<TYPE>::DepthLayout depth_layout =
+         ArrayData<TYPE>::PLANAR);
 
 #if defined(HAVE_UMPIRE)
    /*!
@@ -167,6 +171,8 @@ public:
     *                   with them.
     * @param allocator An Umpire allocator to manage the allocation of the
     *                  underlying data.
+    * @param depth_layout how the depth components are arranged in memory;
+    *              see ArrayData.
     *
     * @pre (box.getDim() == ghosts.getDim()) &&
     *      (box.getDim() == directions.getDim())
@@ -179,7 +185,9 @@ public:
       int depth,
       const hier::IntVector& ghosts,
       const hier::IntVector& directions,
-      umpire::Allocator allocator);
+      umpire::Allocator allocator,
+      typename ArrayData<TYPE>::DepthLayout depth_layout =
+         ArrayData<TYPE>::PLANAR);
 #endif
 
    /*!
@@ -192,7 +200,9 @@ public:
    SideData(
       const hier::Box& box,
       int depth,
-      const hier::IntVector& ghosts);
+      const hier::IntVector& ghosts,
+      typename ArrayData<TYPE>::DepthLayout depth_layout =
+         ArrayData<TYPE>::PLANAR);
 
 #if defined(HAVE_UMPIRE)
    /*!
@@ -207,7 +217,9 @@ public:
       const hier::Box& box,
       int depth,
       const hier::IntVector& ghosts,
-      umpire::Allocator allocator);
+      umpire::Allocator allocator,
+      typename ArrayData<TYPE>::DepthLayout depth_layout =
+         ArrayData<TYPE>::PLANAR);
 #endif
       
    /*!
@@ -234,6 +246,15 @@ public:
    int
    getDepth() const;
 
+   /*!
+    * @brief Return how the depth components are arranged in memory.
+    */
+   typename ArrayData<TYPE>::DepthLayout
+   getDepthLayout() const
+   {
+      return d_data[0]->getDepthLayout();
+   }
+
    /*!
     * @brief Get a pointer to the beginning of a particular side normal and
     * depth component of the side centered array.
@@ -260,7 +281,6 @@ public:
       int side_normal,
       int depth = 0) const;
 
-#if defined(HAVE_RAJA)
    template <int DIM>
    using View = pdat::ArrayView<DIM, TYPE>;
 
@@ -268,7 +288,13 @@ public:
    using ConstView = pdat::ArrayView<DIM, const TYPE>;
 
    /*!
-    * @brief Get an ArrayView that can access the array for RAJA looping.
+    * @brief Get an ArrayView that can access the array in
+    * hier::parallel_for_all loops.
+    *
+    * The view has the strides of ArrayData::getPaddedBox(), which
+    * differ from those of the ghost box for the ArrayData::PADDED
+    * layout.  Views are not available for the ArrayData::INTERLEAVED
+    * layout.
     */
    template <int DIM>
    View<DIM>
@@ -277,14 +303,19 @@ public:
       int depth = 0);
 
    /*!
-    * @brief Get a const ArrayView that can access the array for RAJA looping.
+    * @brief Get a const ArrayView that can access the array in
+    * hier::parallel_for_all loops.
+    *
+    * The view has the strides of ArrayData::getPaddedBox(), which
+    * differ from those of the ghost box for the ArrayData::PADDED
+    * layout.  Views are not available for the ArrayData::INTERLEAVED
+    * layout.
     */
    template <int DIM>
    ConstView<DIM>
    getConstView(
       int side_normal,
       int depth = 0) const;
-#endif
 
    /*!
     * @brief Return a reference to the data entry corresponding
@@ -341,8 +372,9 @@ public:
     * Data is copied where there is overlap in the underlying index space.
     * The copy is performed on the interior plus the ghost cell width (for
     * both the source and destination).  Currently, source data must be
-    * an SideData of the same DIM and TYPE.  If not, then an unrecoverable
-    * error results.
+    * an SideData of the same DIM and TYPE, or of the other floating point
+    * precision (see OtherPrecision), in which case each value is
+    * converted.  If not, then an unrecoverable error results.
     *
     * @pre getDirectionVector().getDim() == src.getDim()
     */
@@ -357,11 +389,10 @@ public:
     * Data is copied where there is overlap in the underlying index space.
     * The copy is performed on the interior plus the ghost cell width (for
     * both the source and destination).  Currently, destination data must be
-    * an SideData of the same DIM and TYPE.  If not, then an unrecoverable
-    * error results.
+    * an SideData of the same DIM and TYPE, or of the other floating point
+    * precision.  If not, then an unrecoverable error results.
     *
     * @pre getDirectionVector().getDim() == dst.getDim()
-    * @pre dynamic_cast<SideData<TYPE> *>(&dst) != 0
     * @pre (dynamic_cast<SideData<TYPE> *>(&dst))->getDirectionVector() == getDirectionVector()
     */
    virtual void
@@ -372,9 +403,10 @@ public:
     * @brief Copy data from source to destination (i.e., this)
     * patch data object on the given overlap.
     *
-    * Currently, source data must be SideData of the same DIM and TYPE
-    * and the overlap must be a SideOverlap of the same DIM. If not,
-    * then an unrecoverable error results.
+    * Currently, source data must be SideData of the same DIM and TYPE,
+    * or of the other floating point precision, and the overlap must be a
+    * SideOverlap of the same DIM.  If not, then an unrecoverable error
+    * results.
     *
     * @pre getDirectionVector().getDim() == src.getDim()
     */
@@ -387,12 +419,12 @@ public:
     * @brief Copy data from source (i.e., this) to destination
     * patch data object on the given overlap.
     *
-    * Currently, destination data must be SideData of the same DIM and TYPE
-    * and the overlap must be a SideOverlap of the same DIM.  If not,
-    * then an unrecoverable error results.
+    * Currently, destination data must be SideData of the same DIM and
+    * TYPE, or of the other floating point precision, and the overlap must
+    * be a SideOverlap of the same DIM.  If not, then an unrecoverable
+    * error results.
     *
     * @pre getDirectionVector().getDim() == dst.getDim()
-    * @pre dynamic_cast<SideData<TYPE> *>(&dst) != 0
     * @pre dynamic_cast<const SideOverlap *>(&overlap) != 0
     * @pre (dynamic_cast<SideData<TYPE> *>(&dst))->getDirectionVector() == getDirectionVector()
     */
@@ -463,6 +495,42 @@ public:
       tbox::MessageStream& stream,
       const hier::BoxOverlap& overlap) const;
 
+   /*!
+    * @brief Set this patch data, over the overlap, to the linear time
+    * interpolation (1 - tfrac) * src_old + tfrac * src_new.
+    *
+    * The result is what copy() would give from SideData holding the
+    * interpolated values, computed without such a temporary.
+    *
+    * @pre dynamic_cast<const SideOverlap *>(&overlap) != 0
+    * @pre overlap.getTransformation().getRotation() ==
+    *      hier::Transformation::NO_ROTATE
+    */
+   void
+   linearTimeInterpolate(
+      const SideData<TYPE>& src_old,
+      const SideData<TYPE>& src_new,
+      double tfrac,
+      const hier::BoxOverlap& overlap);
+
+   /*!
+    * @brief Pack into the stream, over the overlap, the linear time
+    * interpolation (1 - tfrac) * (this data) + tfrac * src_new.
+    *
+    * The stream holds what packStream() would pack from SideData holding
+    * the interpolated values, so it is unpacked with unpackStream().
+    *
+    * @pre dynamic_cast<const SideOverlap *>(&overlap) != 0
+    * @pre overlap.getTransformation().getRotation() ==
+    *      hier::Transformation::NO_ROTATE
+    */
+   void
+   packStreamLinearTimeInterpolated(
+      tbox::MessageStream& stream,
+      const SideData<TYPE>& src_new,
+      double tfrac,
+      const hier::BoxOverlap& overlap) const;
+
    /*!
     * @brief Unpack data from stream into this patch data object over
     * the specified box overlap region. The overlap must be an
@@ -669,19 +737,26 @@ private:
       tbox::MessageStream& stream,
       const SideOverlap& overlap) const;
 
+   /*
+    * Copy into SideData of the other floating point precision, on the
+    * overlap if one is given and on the common ghost region otherwise.
+    */
+   void
+   copyConvertedTo(
+      hier::PatchData& dst,
+      const SideOverlap* overlap) const;
+
    int d_depth;
    hier::IntVector d_directions;
 
    std::shared_ptr<ArrayData<TYPE> > d_data[SAMRAI::MAX_DIM_VAL];
 };
 
-#if defined(HAVE_RAJA)
 template<int DIM, typename TYPE, typename... Args>
 typename SideData<TYPE>::template View<DIM> get_view(SideData<TYPE>& data, Args&&... args);
 
 template<int DIM, typename TYPE, typename... Args>
 typename SideData<TYPE>::template ConstView<DIM> get_const_view(const SideData<TYPE>& data, Args&&... args);
-#endif
 
 }
 }
@@ -17,6 +17,7 @@
 #include "SAMRAI/hier/BoxGeometry.h"
 #include "SAMRAI/hier/IntVector.h"
 #include "SAMRAI/hier/PatchDataFactory.h"
+#include "SAMRAI/pdat/ArrayData.h"
 #include "SAMRAI/tbox/Complex.h"
 
 #include <memory>
@@ -63,6 +64,9 @@ public:
     * default that all directions are desired.  See the
     * SideVariable<TYPE> class header file for more information.
     *
+    * The depth layout argument gives the arrangement of the depth components
+    * in memory; see ArrayData.
+    *
     * @pre depth > 0
     * @pre ghosts.min() >= 0
     * @pre directions.min() >= 0
@@ -71,7 +75,9 @@ public:
       int depth,
       const hier::IntVector& ghosts,
       bool fine_boundary_represents_var,
-      const hier::IntVector& directions);
+      const hier::IntVector& directions,
+      typename ArrayData<TYPE>::DepthLayout depth_layout =
+         ArrayData<TYPE>::PLANAR);
 
 #if defined(HAVE_UMPIRE)
    /**
@@ -87,7 +93,9 @@ public:
       const hier::IntVector& ghosts,
       bool fine_boundary_represents_var,
       const hier::IntVector& directions,
-      umpire::Allocator allocator);
+      umpire::Allocator allocator,
+      typename ArrayData<TYPE>::DepthLayout depth_layout =
+         ArrayData<TYPE>::PLANAR);
 #endif
 
    /*!
@@ -104,7 +112,9 @@ public:
    SideDataFactory(
       int depth,
       const hier::IntVector& ghosts,
-      bool fine_boundary_represents_var);
+      bool fine_boundary_represents_var,
+      typename ArrayData<TYPE>::DepthLayout depth_layout =
+         ArrayData<TYPE>::PLANAR);
 
 #if defined(HAVE_UMPIRE)
    /*!
@@ -122,7 +132,9 @@ public:
       int depth,
       const hier::IntVector& ghosts,
       bool fine_boundary_represents_var,
-      umpire::Allocator allocator);
+      umpire::Allocator allocator,
+      typename ArrayData<TYPE>::DepthLayout depth_layout =
+         ArrayData<TYPE>::PLANAR);
 #endif
    /**
     * Virtual destructor for the side data factory class.
@@ -174,6 +186,16 @@ public:
    int
    getDepth() const;
 
+   /**
+    * Get the arrangement in memory of the depth components of the data
+    * objects created by this factory.
+    */
+   typename ArrayData<TYPE>::DepthLayout
+   getDepthLayout() const
+   {
+      return d_depth_layout;
+   }
+
    /**
     * Return constant reference to vector describing which coordinate
     * directions have data associated with this side data object.
@@ -214,7 +236,8 @@ public:
    /**
     * Return whether it is valid to copy this SideDataFactory to the
     * supplied destination patch data factory.  It will return true if
-    * dst_pdf is SideDataFactory or OutersideDataFactory, false otherwise.
+    * dst_pdf is SideDataFactory of TYPE or of the other floating point
+    * precision, or OutersideDataFactory, false otherwise.
     *
     * @pre getDim() == dst_pdf->getDim()
     */
@@ -222,10 +245,22 @@ public:
    validCopyTo(
       const std::shared_ptr<hier::PatchDataFactory>& dst_pdf) const;
 
+   /**
+    * Return whether data of the supplied destination factory can unpack
+    * streams of this SideData, which is not the case for SideData of the
+    * other floating point precision.
+    *
+    * @pre getDim() == dst_pdf->getDim()
+    */
+   bool
+   validStreamTo(
+      const std::shared_ptr<hier::PatchDataFactory>& dst_pdf) const;
+
 private:
    int d_depth;
    bool d_fine_boundary_represents_var;
    hier::IntVector d_directions;
+   typename ArrayData<TYPE>::DepthLayout d_depth_layout;
 
 #if defined(HAVE_UMPIRE)
    umpire::Allocator d_allocator;
@@ -15,6 +15,7 @@
 
 #include "SAMRAI/hier/IntVector.h"
 #include "SAMRAI/hier/Variable.h"
+#include "SAMRAI/pdat/ArrayData.h"
 #include "SAMRAI/tbox/Complex.h"
 
 #include <string>
@@ -55,14 +56,17 @@ public:
     * boolean argument indicates which values (either coarse or fine) take
     * precedence at coarse-fine mesh boundaries during coarsen and refine
     * operations.  The default is that fine data values take precedence
-    * on coarse-fine interfaces.
+    * on coarse-fine interfaces.  The depth layout gives the arrangement in
+    * memory of the depth components of the side data; see ArrayData.
     */
    SideVariable(
       const tbox::Dimension& dim,
       const std::string& name,
       const hier::IntVector& directions,
       int depth = 1,
-      bool fine_boundary_represents_var = true);
+      bool fine_boundary_represents_var = true,
+      typename ArrayData<TYPE>::DepthLayout depth_layout =
+         ArrayData<TYPE>::PLANAR);
 
    /*!
     * @brief Constructor that will assume a directions vector of 1 in
@@ -76,7 +80,9 @@ public:
       const tbox::Dimension& dim,
       const std::string& name,
       int depth = 1,
-      bool fine_boundary_represents_var = true);
+      bool fine_boundary_represents_var = true,
+      typename ArrayData<TYPE>::DepthLayout depth_layout =
+         ArrayData<TYPE>::PLANAR);
 
    /*!
     * @brief Virtual destructor for side variable objects.
@@ -18,7 +18,7 @@
 #include "SAMRAI/pdat/IntegerAttributeId.h"
 #include "SAMRAI/pdat/DoubleAttributeId.h"
 
-#include <list>
+#include <cstddef>
 #include <string>
 #include <vector>
 #include <unordered_map>
@@ -102,6 +102,18 @@ operator << (
  * Since SparseData is derived from hier::PatchData, its interface conforms
  * to the standard interface that PatchData defines.
  *
+ * STORAGE
+ *
+ * The Index elements are kept in an array, in the order they are
+ * registered, and found through an open addressing hash table of their
+ * positions.  Each attribute collection is a record, and the values of
+ * each attribute are stored in a contiguous column indexed by record, so
+ * that inserting a collection does not allocate and packing copies runs
+ * of records one column at a time.  The records of an Index element are
+ * chained in insertion order.  Removing an element moves the last
+ * element into its place, and references to attribute values are
+ * invalidated by inserting collections.
+ *
  * TEMPLATE PARAMETERS
  *
  * The BOX_GEOMETRY template parameter defines the geometry.  It must have
@@ -121,13 +133,6 @@ template<typename BOX_GEOMETRY>
 class SparseData:public hier::PatchData
 {
 private:
-   class Attributes;
-   struct index_hash;
-
-   template <class T>
-   static
-   void hash_combine(std::size_t& seed, const T& v);
-
    template <class T>
    void to_lower(T& input);
 
@@ -380,7 +385,9 @@ public:
     * </code>
     *
     * "remove" will automatically increment the iterator such that the
-    * next test of the loop will occur correctly.
+    * next test of the loop will occur correctly.  The last element is
+    * moved to the position of the removed one, so other iterators to the
+    * last element are invalidated.
     */
    void
    remove(
@@ -479,14 +486,31 @@ public:
    friend class SparseDataAttributeIterator<BOX_GEOMETRY>;
 private:
    // Internal typedefs
-   typedef std::list<Attributes> AttributeList;
-   typedef std::unordered_map<
-      hier::Index, AttributeList, index_hash> IndexMap;
    typedef std::unordered_map<
       std::string, DoubleAttributeId> DoubleAttrNameMap;
    typedef std::unordered_map<
       std::string, IntegerAttributeId> IntAttrNameMap;
 
+   /*
+    * An Index element: the Index and the chain of records holding its
+    * attribute collections, linked through d_next_record.
+    */
+   struct Item {
+      hier::Index d_index;
+      int d_first_record;
+      int d_last_record;
+      int d_num_records;
+
+      explicit Item(
+         const hier::Index& index):
+         d_index(index),
+         d_first_record(NO_RECORD),
+         d_last_record(NO_RECORD),
+         d_num_records(0)
+      {
+      }
+   };
+
    /*
     * Copy c'tor and assignment operator are private to prevent
     * the compiler from generating a default
@@ -503,9 +527,30 @@ private:
    const tbox::Dimension d_dim;
 
    /*
-    * The map of index to attributes.  See typedef above
+    * The Index elements, in iteration order.  Removing an element moves
+    * the last one into its place.
+    */
+   std::vector<Item> d_items;
+
+   /*
+    * Open addressing table from Index to position in d_items, with
+    * linear probing.  Empty slots hold NO_ITEM.  The size is a power of
+    * two and at least twice the number of items.
+    */
+   std::vector<int> d_slots;
+
+   /*
+    * Attribute values, one column per attribute, indexed by record.
     */
-   IndexMap d_index_to_attribute_map;
+   std::vector<std::vector<double> > d_dbl_columns;
+   std::vector<std::vector<int> > d_int_columns;
+
+   /*
+    * Next record in the chain of an item, or in the list of free records
+    * starting at d_free_record.
+    */
+   std::vector<int> d_next_record;
+   int d_free_record;
 
    /*
     * Registered name to ID maps.  See typedef above
@@ -527,126 +572,136 @@ private:
     */
    static const int INVALID_ID;
 
+   /*
+    * Markers for an empty slot and the end of a record chain.
+    */
+   static const int NO_ITEM = -1;
+   static const int NO_RECORD = -1;
+
+   /*
+    * Smallest size of the slot table once an item is registered.
+    */
+   static const int MIN_SLOTS = 16;
+
    /**********************************************************************
     * Private methods for this class
     *********************************************************************/
 
    /*
-    * Get the attribute list for this index.
+    * Hash an Index to a slot of the table.
+    */
+   size_t
+   _getHomeSlot(
+      const hier::Index& index) const;
+
+   /*
+    * Return the slot holding the index or, if it is not registered, the
+    * empty slot where it would go.
+    */
+   size_t
+   _findSlot(
+      const hier::Index& index) const;
+
+   /*
+    * Return the position of the index in d_items, or NO_ITEM.
     *
     * ASSERTION: Dimensions of the <tt>index</tt> and this must be the same.
     */
-   //std::list<Attributes>& _get(const hier::Index& index) const;
-   AttributeList&
-   _get(
+   int
+   _findItem(
       const hier::Index& index) const;
 
    /*
-    * Add this item to the index to attribute map
+    * Return the position of the index in d_items, registering it if
+    * needed.
+    */
+   int
+   _findOrAddItem(
+      const hier::Index& index);
+
+   /*
+    * Resize the slot table and reinsert all items.
     */
    void
-   _add(
-      const typename IndexMap::const_iterator& item_to_add);
+   _rehash(
+      size_t num_slots);
 
    /*
-    * iterate through the index elements in this object, and if
-    * the index is contained within the box, remove it from the
-    * d_list.
+    * Remove an item and its records.  The last item is moved into its
+    * position.
     */
    void
-   _removeInsideBox(
-      const hier::Box& box);
+   _eraseItem(
+      int item);
 
    /*
-    * The index hash function for adding elements to the std::unordered_map's
-    * buckets.
-    */
-   struct index_hash:
-      std::unary_function<hier::Index, std::size_t>{
-      std::size_t
-      operator () (
-         const hier::Index& index) const;
-   };
+    * Add a record at the end of the chain of an item and return it.  The
+    * values of the record are not set.
+    */
+   int
+   _appendRecord(
+      int item);
 
    /*
-    * Internal attribute class.  Clients of SparseData will never use this
-    * directly.
-    *
-    * This is intentionally kept as simple an implementation as possible.
-    * We will add complexity if it becomes necessary.
+    * Set the values of a record.
     */
-   class Attributes
-   {
-public:
-      /**********************************************************************
-      * Constructors, assignment, destructor
-      **********************************************************************/
-      Attributes(
-         const int dsize,
-         const int isize);
-      Attributes(
-         const Attributes& other);
-      Attributes&
-      operator = (
-         const Attributes& rhs);
-      ~Attributes();
-
-      /**********************************************************************
-      * modifiers
-      **********************************************************************/
-      void
-      add(
-         const double * dvals,
-         const int * ivals);
-      void
-      add(
-         const std::vector<double>& dvals,
-         const std::vector<int>& ivals);
-
-      /**********************************************************************
-      * non-modifying operations
-      **********************************************************************/
-      const double *
-      getDoubleAttributes() const;
-      const int *
-      getIntAttributes() const;
-
-      /**********************************************************************
-      * operators (modifying and non-modifying
-      **********************************************************************/
-      double&
-      operator [] (
-         const DoubleAttributeId& id);
-      const double&
-      operator [] (
-         const DoubleAttributeId& id) const;
-      int&
-      operator [] (
-         const IntegerAttributeId& id);
-      const int&
-      operator [] (
-         const IntegerAttributeId& id) const;
-
-      bool
-      operator == (
-         const Attributes& rhs) const;
-
-      /**********************************************************************
-      * output
-      **********************************************************************/
-      void
-      printAttributes(
-         std::ostream& out) const;
-private:
-      // internal typedefs
-      typedef std::vector<double>::const_iterator dbl_iterator;
-      typedef std::vector<int>::const_iterator int_iterator;
+   void
+   _setRecord(
+      int record,
+      const double* dvals,
+      const int* ivals);
+
+   /*
+    * Return the records of an item to the free list.
+    */
+   void
+   _freeRecords(
+      int item);
+
+   /*
+    * Append copies of the records of an item of src to an item of this.
+    */
+   void
+   _appendRecords(
+      int item,
+      const SparseData& src,
+      int src_item);
+
+   /*
+    * Return true if an item of this and an item of other have the same
+    * records in the same order.
+    */
+   bool
+   _hasSameRecords(
+      int item,
+      const SparseData& other,
+      int other_item) const;
+
+   /*
+    * Collect the items to pack for an overlap and their total number of
+    * records.
+    */
+   void
+   _getItemsToPack(
+      const hier::BoxOverlap& overlap,
+      std::vector<int>& items,
+      int& num_records) const;
 
-      // data members
-      std::vector<double> d_dbl_attrs;
-      std::vector<int> d_int_attrs;
-   };  // end class Attributes
+   /*
+    * iterate through the index elements in this object, and if
+    * the index is contained within the box, remove it.
+    */
+   void
+   _removeInsideBox(
+      const hier::Box& box);
 
+   /*
+    * Print the values of a record.
+    */
+   void
+   _printRecord(
+      std::ostream& out,
+      int record) const;
 };
 
 /**********************************************************************
@@ -809,12 +864,16 @@ public:
 private:
    friend class SparseData<BOX_GEOMETRY>;
 
-   typedef typename SparseData<BOX_GEOMETRY>::AttributeList AttributeList;
    /**********************************************************************
    * Data members
    **********************************************************************/
    SparseData<BOX_GEOMETRY>* d_data;
-   typename SparseData<BOX_GEOMETRY>::IndexMap::iterator d_iterator;
+
+   /*
+    * Position of the current item in the items of d_data, or
+    * SparseData<BOX_GEOMETRY>::NO_ITEM at the end.
+    */
+   int d_item;
 
    /**********************************************************************
    * private  methods for internal use only since they expose
@@ -822,11 +881,7 @@ private:
    **********************************************************************/
    SparseDataIterator(
       SparseData<BOX_GEOMETRY>& sparse_data,
-      typename SparseData<BOX_GEOMETRY>::IndexMap::iterator iterator);
-
-   void
-   _insert(
-      const typename SparseData<BOX_GEOMETRY>::Attributes& attributes);
+      int item);
 
    /*!
     * @brief prints the contents of this Iterator (Index + all attributes).
@@ -937,15 +992,17 @@ public:
 
 private:
    friend class SparseData<BOX_GEOMETRY>;
-   typedef typename SparseData<BOX_GEOMETRY>::Attributes Attributes;
-   typedef typename SparseData<BOX_GEOMETRY>::AttributeList AttributeList;
 
    SparseDataAttributeIterator(
-      const AttributeList& attributes,
-      const typename AttributeList::iterator& iterator);
+      const SparseData<BOX_GEOMETRY>& sparse_data,
+      int record);
+
+   SparseData<BOX_GEOMETRY>* d_data;
 
-   AttributeList d_list;
-   typename AttributeList::iterator d_list_iterator;
+   /*
+    * Current record, or SparseData<BOX_GEOMETRY>::NO_RECORD at the end.
+    */
+   int d_record;
 
    /*!
     * @brief print the attributes.  Called from the ostream<< operator.
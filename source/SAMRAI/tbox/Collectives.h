@@ -4,18 +4,24 @@
  * information, see COPYRIGHT and LICENSE.
  *
  * Copyright:     (c) 1997-2020 Lawrence Livermore National Security, LLC
- * Description:   RAJA collective operations
+ * Description:   Collective operations for loop abstractions
  *
  ************************************************************************/
 
 #ifndef included_tbox_Collectives
 #define included_tbox_Collectives
 
-#if defined(HAVE_RAJA)
+#include "SAMRAI/SAMRAI_config.h"
 
+#if defined(HAVE_RAJA)
 #include "RAJA/RAJA.hpp"
+#endif
 
 #include "SAMRAI/tbox/ExecutionPolicy.h"
+#include "SAMRAI/tbox/OpenMPUtilities.h"
+
+#include <memory>
+#include <vector>
 
 namespace SAMRAI {
 namespace tbox {
@@ -24,7 +30,7 @@ template <typename policy>
 inline void
 synchronize() {}
 
-#if defined(HAVE_CUDA)
+#if defined(HAVE_RAJA) && defined(HAVE_CUDA)
 template<>
 inline void
 synchronize<policy::parallel>()
@@ -49,6 +55,8 @@ enum class Reduction {
 template<typename Policy, Reduction R, typename TYPE = double>
 struct reduction_variable;
 
+#if defined(HAVE_RAJA)
+
 template<typename Policy, typename TYPE>
 struct reduction_variable<Policy, Reduction::Sum, TYPE> {
    using type = RAJA::ReduceSum<typename detail::policy_traits<Policy>::ReductionPolicy, TYPE>;
@@ -74,6 +82,191 @@ struct reduction_variable<Policy, Reduction::MaxLoc, TYPE> {
    using type = RAJA::ReduceMaxLoc<typename detail::policy_traits<Policy>::ReductionPolicy, TYPE>;
 };
 
+#else // HAVE_RAJA
+
+namespace detail {
+
+/*
+ * Reduction variable for the native loops of hier/ForAll.h, with the
+ * interface of the RAJA reduction objects.  The loop body captures the
+ * variable by value, so copies share one partial result per OpenMP
+ * thread, each on its own cache line.  The partial results are combined
+ * by get().  Only Sum, Min and Max are provided.
+ *
+ * A variable made inside a parallel region has a partial result for
+ * each thread of that region as well as for a new team.  Any thread
+ * numbered beyond them updates one more, shared partial result in a
+ * critical section.
+ */
+template<typename TYPE, typename OP>
+class native_reduction
+{
+public:
+   explicit native_reduction(
+      TYPE init):
+      d_init(init),
+      d_partials(std::make_shared<std::vector<Partial> >(
+                    getNumberOfThreadPartials() + 1))
+   {
+      reset(init);
+   }
+
+   void
+   reset(
+      TYPE init)
+   {
+      d_init = init;
+      for (size_t t = 0; t < d_partials->size(); ++t) {
+         (*d_partials)[t].value = OP::identity(init);
+      }
+   }
+
+   TYPE
+   get() const
+   {
+      TYPE result = d_init;
+      for (size_t t = 0; t < d_partials->size(); ++t) {
+         result = OP::combine(result, (*d_partials)[t].value);
+      }
+      return result;
+   }
+
+   operator TYPE() const
+   {
+      return get();
+   }
+
+protected:
+   void
+   update(
+      TYPE value) const
+   {
+      const size_t thread = TBOX_omp_get_thread_num();
+      if (thread + 1 < d_partials->size()) {
+         TYPE& partial = (*d_partials)[thread].value;
+         partial = OP::combine(partial, value);
+      } else {
+#ifdef HAVE_OPENMP
+#pragma omp critical(tbox_native_reduction)
+#endif
+         {
+            TYPE& partial = d_partials->back().value;
+            partial = OP::combine(partial, value);
+         }
+      }
+   }
+
+private:
+   static size_t
+   getNumberOfThreadPartials()
+   {
+      size_t num_partials = TBOX_omp_get_max_threads();
+#ifdef HAVE_OPENMP
+      if (omp_in_parallel() &&
+          static_cast<size_t>(omp_get_num_threads()) > num_partials) {
+         num_partials = omp_get_num_threads();
+      }
+#endif
+      return num_partials;
+   }
+
+   struct Partial {
+      TYPE value;
+      char padding[64];
+   };
+
+   TYPE d_init;
+   std::shared_ptr<std::vector<Partial> > d_partials;
+};
+
+struct sum_op {
+   template<typename TYPE>
+   static TYPE identity(TYPE) { return TYPE(0); }
+   template<typename TYPE>
+   static TYPE combine(TYPE a, TYPE b) { return a + b; }
+};
+
+struct min_op {
+   template<typename TYPE>
+   static TYPE identity(TYPE init) { return init; }
+   template<typename TYPE>
+   static TYPE combine(TYPE a, TYPE b) { return b < a ? b : a; }
+};
+
+struct max_op {
+   template<typename TYPE>
+   static TYPE identity(TYPE init) { return init; }
+   template<typename TYPE>
+   static TYPE combine(TYPE a, TYPE b) { return a < b ? b : a; }
+};
+
+template<typename TYPE>
+class ReduceSum : public native_reduction<TYPE, sum_op>
+{
+public:
+   explicit ReduceSum(TYPE init = TYPE(0)):
+      native_reduction<TYPE, sum_op>(init) {}
+
+   const ReduceSum&
+   operator += (
+      TYPE value) const
+   {
+      this->update(value);
+      return *this;
+   }
+};
+
+template<typename TYPE>
+class ReduceMin : public native_reduction<TYPE, min_op>
+{
+public:
+   explicit ReduceMin(TYPE init):
+      native_reduction<TYPE, min_op>(init) {}
+
+   const ReduceMin&
+   min(
+      TYPE value) const
+   {
+      this->update(value);
+      return *this;
+   }
+};
+
+template<typename TYPE>
+class ReduceMax : public native_reduction<TYPE, max_op>
+{
+public:
+   explicit ReduceMax(TYPE init):
+      native_reduction<TYPE, max_op>(init) {}
+
+   const ReduceMax&
+   max(
+      TYPE value) const
+   {
+      this->update(value);
+      return *this;
+   }
+};
+
+} // namespace detail
+
+template<typename Policy, typename TYPE>
+struct reduction_variable<Policy, Reduction::Sum, TYPE> {
+   using type = detail::ReduceSum<TYPE>;
+};
+
+template<typename Policy, typename TYPE>
+struct reduction_variable<Policy, Reduction::Min, TYPE> {
+   using type = detail::ReduceMin<TYPE>;
+};
+
+template<typename Policy, typename TYPE>
+struct reduction_variable<Policy, Reduction::Max, TYPE> {
+   using type = detail::ReduceMax<TYPE>;
+};
+
+#endif // HAVE_RAJA
+
 template<Reduction R, typename TYPE = double>
 using parallel_reduction_variable = reduction_variable<tbox::policy::parallel, R, TYPE>;
 
@@ -85,5 +278,5 @@ using parallel_reduction_variable_t = typename parallel_reduction_variable<R, TY
 
 }
 }
-#endif
+
 #endif
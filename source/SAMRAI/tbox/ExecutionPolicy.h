@@ -4,26 +4,49 @@
  * information, see COPYRIGHT and LICENSE.
  *
  * Copyright:     (c) 1997-2020 Lawrence Livermore National Security, LLC
- * Description:   Manages execution policy for RAJA
+ * Description:   Manages execution policy for loop abstractions
  *
  ************************************************************************/
 
 #ifndef included_tbox_ExecutionPolicy
 #define included_tbox_ExecutionPolicy
 
-#if defined(HAVE_RAJA)
+#include "SAMRAI/SAMRAI_config.h"
 
+#if defined(HAVE_RAJA)
 #include "RAJA/RAJA.hpp"
+#endif
 
 namespace SAMRAI {
 namespace tbox {
 
+/*!
+ * Execution policies for the loops in hier/ForAll.h.
+ *
+ * sequential runs a loop on the calling thread.  parallel uses the
+ * default parallel execution of the build: CUDA when SAMRAI is
+ * configured with it, otherwise CPU threads when OpenMP is enabled.
+ *
+ * tiled<TILE_I, TILE_J, TILE_K> runs 2D and 3D box loops over tiles of
+ * TILE_I x TILE_J x TILE_K cells, distributing the tiles over CPU
+ * threads when OpenMP is enabled, so that stencil kernels reuse data in
+ * cache.  TILE_K is ignored by 2D loops.  In CUDA builds it is the same
+ * as parallel.
+ */
 namespace policy {
 struct base {};
 struct sequential : base {};
 struct parallel : base {};
+
+template <int TILE_I, int TILE_J, int TILE_K = 1>
+struct tiled : base {
+   static_assert(TILE_I > 0 && TILE_J > 0 && TILE_K > 0,
+      "tile sizes must be positive");
+};
 }
 
+#if defined(HAVE_RAJA)
+
 namespace detail {
 
 template <typename pol>
@@ -111,6 +134,10 @@ struct policy_traits<policy::parallel> {
    using ReductionPolicy = RAJA::cuda_reduce;
 };
 
+template <int TILE_I, int TILE_J, int TILE_K>
+struct policy_traits<policy::tiled<TILE_I, TILE_J, TILE_K> > :
+   policy_traits<policy::parallel> {};
+
 #else
 
 // TODO: Make this an OpenMP policy if that is defined
@@ -145,13 +172,102 @@ struct policy_traits<policy::parallel> {
    using ReductionPolicy = RAJA::seq_reduce;
 };
 
+template <int TILE_I, int TILE_J, int TILE_K>
+struct policy_traits<policy::tiled<TILE_I, TILE_J, TILE_K> > {
+   using Policy = RAJA::loop_exec;
+
+   using Policy1d = RAJA::KernelPolicy<
+      RAJA::statement::For<0, RAJA::loop_exec,
+         RAJA::statement::Lambda<0>
+      >
+   >;
+
+   using Policy2d = RAJA::KernelPolicy<
+      RAJA::statement::Tile<1, RAJA::statement::tile_fixed<TILE_J>, RAJA::loop_exec,
+         RAJA::statement::Tile<0, RAJA::statement::tile_fixed<TILE_I>, RAJA::loop_exec,
+            RAJA::statement::For<1, RAJA::loop_exec,
+               RAJA::statement::For<0, RAJA::loop_exec,
+                  RAJA::statement::Lambda<0>
+               >
+            >
+         >
+      >
+   >;
+
+   using Policy3d = RAJA::KernelPolicy<
+      RAJA::statement::Tile<2, RAJA::statement::tile_fixed<TILE_K>, RAJA::loop_exec,
+         RAJA::statement::Tile<1, RAJA::statement::tile_fixed<TILE_J>, RAJA::loop_exec,
+            RAJA::statement::Tile<0, RAJA::statement::tile_fixed<TILE_I>, RAJA::loop_exec,
+               RAJA::statement::For<2, RAJA::loop_exec,
+                  RAJA::statement::For<1, RAJA::loop_exec,
+                     RAJA::statement::For<0, RAJA::loop_exec,
+                        RAJA::statement::Lambda<0>
+                     >
+                  >
+               >
+            >
+         >
+      >
+   >;
+
+   using ReductionPolicy = RAJA::seq_reduce;
+};
+
 #endif // HAVE_CUDA
 
 } // namespace detail
 
-}
-}
+#else // HAVE_RAJA
+
+namespace detail {
+
+/*
+ * Loop parameters for the native implementation of hier/ForAll.h.
+ * Box loops are run over tiles of tile_i x tile_j x tile_k cells, where
+ * a size of 0 means the whole extent of the box in that direction.
+ * When threaded is true and OpenMP is enabled, the tiles of loops with
+ * at least min_parallel_size iterations are distributed over threads.
+ * When runtime_tiling is true, the tile sizes are instead taken from
+ * SAMRAIManager::getLoopTileSize().
+ */
+template <typename pol>
+struct policy_traits {};
+
+template <>
+struct policy_traits<policy::sequential> {
+   static constexpr bool threaded = false;
+   static constexpr bool runtime_tiling = false;
+   static constexpr int tile_i = 0;
+   static constexpr int tile_j = 0;
+   static constexpr int tile_k = 0;
+   static constexpr long min_parallel_size = 0;
+};
+
+template <>
+struct policy_traits<policy::parallel> {
+   static constexpr bool threaded = true;
+   static constexpr bool runtime_tiling = true;
+   static constexpr int tile_i = 0;
+   static constexpr int tile_j = 1;
+   static constexpr int tile_k = 1;
+   static constexpr long min_parallel_size = 4096;
+};
+
+template <int TILE_I, int TILE_J, int TILE_K>
+struct policy_traits<policy::tiled<TILE_I, TILE_J, TILE_K> > {
+   static constexpr bool threaded = true;
+   static constexpr bool runtime_tiling = false;
+   static constexpr int tile_i = TILE_I;
+   static constexpr int tile_j = TILE_J;
+   static constexpr int tile_k = TILE_K;
+   static constexpr long min_parallel_size = 4096;
+};
+
+} // namespace detail
 
 #endif // HAVE_RAJA
 
+}
+}
+
 #endif
@@ -0,0 +1,393 @@
+/*************************************************************************
+ *
+ * This file is part of the SAMRAI distribution.  For full copyright
+ * information, see COPYRIGHT and LICENSE.
+ *
+ * Copyright:     (c) 1997-2020 Lawrence Livermore National Security, LLC
+ * Description:   Size-class pool allocator for array data
+ *
+ ************************************************************************/
+
+#ifndef included_tbox_MemoryPool
+#define included_tbox_MemoryPool
+
+#include "SAMRAI/SAMRAI_config.h"
+
+#include "SAMRAI/tbox/OpenMPUtilities.h"
+
+#include <atomic>
+#include <cstddef>
+#include <iostream>
+#include <vector>
+
+namespace SAMRAI {
+namespace tbox {
+
+/*!
+ * @brief Pool allocator that recycles aligned blocks by size class.
+ *
+ * MemoryPool is the default source of pdat::ArrayData storage when
+ * SAMRAI is built without Umpire.  Patch data for scratch and
+ * temporary contexts is typically allocated and freed every time step
+ * with the same sizes, so keeping freed blocks for reuse avoids most
+ * calls to the system allocator.  Blocks are not initialized.
+ *
+ * Requests are rounded up to a size class.  There are four classes for
+ * each power of two, so rounding wastes at most a quarter of a block.
+ * Every block is aligned to ALIGNMENT bytes.  Requests larger than
+ * getMaxPooledBytes() go straight to the system.
+ *
+ * Freed blocks are first kept in a small cache private to the freeing
+ * thread, so threaded patch loops do not contend for a lock, and then
+ * in a shared cache.  Blocks beyond the cache limits are returned to
+ * the system.
+ *
+ * On systems supporting transparent huge pages, blocks of at least
+ * HUGE_PAGE_SIZE bytes can be aligned to huge pages and marked as
+ * candidates for them; see setUseHugePages().
+ *
+ * Statistics on allocations, reuse and memory held are kept per
+ * process and written by printStatistics().
+ *
+ * There is a single pool, accessed with getPool().  It is safe to use
+ * from multiple threads.
+ */
+class MemoryPool
+{
+public:
+   /*!
+    * @brief Alignment, in bytes, of every block.
+    */
+   static const size_t ALIGNMENT = 64;
+
+   /*!
+    * @brief Size of a huge page, in bytes.
+    */
+   static const size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+   /*!
+    * @brief Stride, in bytes, at which touchPages() writes.
+    */
+   static const size_t PAGE_SIZE = 4096;
+
+   /*!
+    * @brief Return the pool.
+    */
+   static MemoryPool *
+   getPool();
+
+   /*!
+    * @brief Allocate an aligned, uninitialized block of at least the
+    * given size.
+    *
+    * @param[in] num_bytes
+    *
+    * @return Pointer to the block, or 0 if num_bytes is 0.
+    */
+   void *
+   allocate(
+      size_t num_bytes);
+
+   /*!
+    * @brief Return a block obtained from allocate().
+    *
+    * @param[in] ptr  The block.  A null pointer is ignored.
+    * @param[in] num_bytes  The size given to allocate() for the block.
+    */
+   void
+   deallocate(
+      void* ptr,
+      size_t num_bytes);
+
+   /*!
+    * @brief Return the shared cache and the calling thread's cache to
+    * the system.
+    */
+   void
+   releaseCachedMemory();
+
+   /*!
+    * @brief Set whether freed blocks are cached for reuse.
+    *
+    * When disabled, blocks are still rounded and aligned, but every
+    * allocation and deallocation goes to the system.  This may be
+    * changed at any time.
+    *
+    * @param[in] enabled @b Default: true
+    */
+   void
+   setEnabled(
+      bool enabled)
+   {
+      d_enabled = enabled;
+      if (!enabled) {
+         releaseCachedMemory();
+      }
+   }
+
+   /*!
+    * @brief Return whether freed blocks are cached for reuse.
+    */
+   bool
+   isEnabled() const
+   {
+      return d_enabled;
+   }
+
+   /*!
+    * @brief Set whether large blocks are placed on huge pages.
+    *
+    * Blocks of at least HUGE_PAGE_SIZE bytes are then aligned to
+    * HUGE_PAGE_SIZE and advised as huge page candidates.  This has no
+    * effect where transparent huge pages are not supported.
+    *
+    * @param[in] use_huge_pages @b Default: false
+    */
+   void
+   setUseHugePages(
+      bool use_huge_pages)
+   {
+      d_use_huge_pages = use_huge_pages;
+   }
+
+   /*!
+    * @brief Return whether large blocks are placed on huge pages.
+    */
+   bool
+   getUseHugePages() const
+   {
+      return d_use_huge_pages;
+   }
+
+   /*!
+    * @brief Set whether allocations by the calling thread are placed
+    * in that thread's memory.
+    *
+    * Operating systems place a page on the NUMA domain of the thread
+    * that first writes it.  While first touch is set for a thread,
+    * allocate() writes every page of the blocks it returns to that
+    * thread, and does not reuse blocks from the shared cache, which may
+    * have been placed by other threads.  The setting is private to the
+    * calling thread.
+    *
+    * @param[in] first_touch @b Default: false
+    *
+    * @see hier::PatchLevel::setUseFirstTouchPlacement()
+    */
+   static void
+   setFirstTouch(
+      bool first_touch)
+   {
+      s_first_touch = first_touch;
+   }
+
+   /*!
+    * @brief Return whether allocations by the calling thread are placed
+    * in that thread's memory.
+    */
+   static bool
+   getFirstTouch()
+   {
+      return s_first_touch;
+   }
+
+   /*!
+    * @brief Write one byte in every page of a block so the pages are
+    * placed in the calling thread's memory.
+    *
+    * The contents of the block are undefined afterwards.
+    *
+    * @param[in,out] ptr
+    * @param[in] num_bytes
+    */
+   static void
+   touchPages(
+      void* ptr,
+      size_t num_bytes);
+
+   /*!
+    * @brief Set the most memory the shared cache may hold.
+    *
+    * @param[in] max_cached_bytes @b Default: 1 GiB
+    */
+   void
+   setMaxCachedBytes(
+      size_t max_cached_bytes)
+   {
+      d_max_cached_bytes = max_cached_bytes;
+   }
+
+   /*!
+    * @brief Set the most memory each thread's cache may hold.
+    *
+    * @param[in] max_thread_cached_bytes @b Default: 16 MiB
+    */
+   void
+   setMaxThreadCachedBytes(
+      size_t max_thread_cached_bytes)
+   {
+      d_max_thread_cached_bytes = max_thread_cached_bytes;
+   }
+
+   /*!
+    * @brief Return the largest request served from size classes.
+    */
+   static size_t
+   getMaxPooledBytes();
+
+   /*!
+    * @brief Return the number of calls to allocate() with a non-zero
+    * size.
+    */
+   size_t
+   getNumberOfAllocations() const
+   {
+      return d_num_allocations;
+   }
+
+   /*!
+    * @brief Return the number of allocations served from a cache.
+    */
+   size_t
+   getNumberOfReuses() const
+   {
+      return d_num_reuses;
+   }
+
+   /*!
+    * @brief Return the number of blocks obtained from the system.
+    */
+   size_t
+   getNumberOfSystemAllocations() const
+   {
+      return d_num_system_allocations;
+   }
+
+   /*!
+    * @brief Return the bytes in blocks currently allocated.
+    */
+   size_t
+   getBytesInUse() const
+   {
+      return d_bytes_in_use;
+   }
+
+   /*!
+    * @brief Return the highest value of getBytesInUse() since the
+    * statistics were last reset.
+    */
+   size_t
+   getPeakBytesInUse() const
+   {
+      return d_peak_bytes_in_use;
+   }
+
+   /*!
+    * @brief Return the bytes in blocks held in caches.
+    */
+   size_t
+   getBytesCached() const
+   {
+      return d_bytes_cached;
+   }
+
+   /*!
+    * @brief Reset the allocation counters and the peak bytes in use.
+    */
+   void
+   resetStatistics();
+
+   /*!
+    * @brief Write the statistics to a stream.
+    *
+    * @param[in,out] os
+    */
+   void
+   printStatistics(
+      std::ostream& os) const;
+
+private:
+   class ThreadCache;
+
+   MemoryPool();
+
+   ~MemoryPool();
+
+   // Unimplemented copy constructor.
+   MemoryPool(
+      const MemoryPool& other);
+
+   // Unimplemented assignment operator.
+   MemoryPool&
+   operator = (
+      const MemoryPool& rhs);
+
+   /*!
+    * @brief Return the size class for a request.
+    */
+   static int
+   getSizeClass(
+      size_t num_bytes);
+
+   /*!
+    * @brief Return the block size of a size class.
+    */
+   static size_t
+   getClassSize(
+      int size_class);
+
+   /*!
+    * @brief Return the calling thread's cache.
+    */
+   static ThreadCache&
+   getThreadCache();
+
+   void *
+   allocateFromSystem(
+      size_t num_bytes);
+
+   void
+   freeToSystem(
+      void* ptr,
+      size_t num_bytes);
+
+   /*!
+    * @brief Put a block in the shared cache or free it if the cache is
+    * full.
+    */
+   void
+   cacheBlock(
+      void* ptr,
+      int size_class);
+
+   /*!
+    * @brief Free everything in the shared cache.
+    */
+   void
+   releaseSharedCache();
+
+   static const int NUM_SIZE_CLASSES;
+
+   static thread_local bool s_first_touch;
+
+   std::vector<std::vector<void *> > d_shared_blocks;
+   size_t d_shared_bytes;
+   TBOX_omp_lock_t d_lock;
+
+   bool d_enabled;
+   bool d_use_huge_pages;
+   size_t d_max_cached_bytes;
+   size_t d_max_thread_cached_bytes;
+
+   std::atomic<size_t> d_num_allocations;
+   std::atomic<size_t> d_num_reuses;
+   std::atomic<size_t> d_num_system_allocations;
+   std::atomic<size_t> d_bytes_in_use;
+   std::atomic<size_t> d_peak_bytes_in_use;
+   std::atomic<size_t> d_bytes_cached;
+};
+
+}
+}
+
+#endif
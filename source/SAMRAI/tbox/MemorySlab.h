@@ -0,0 +1,169 @@
+/*************************************************************************
+ *
+ * This file is part of the SAMRAI distribution.  For full copyright
+ * information, see COPYRIGHT and LICENSE.
+ *
+ * Copyright:     (c) 1997-2020 Lawrence Livermore National Security, LLC
+ * Description:   Contiguous block of memory carved into aligned pieces
+ *
+ ************************************************************************/
+
+#ifndef included_tbox_MemorySlab
+#define included_tbox_MemorySlab
+
+#include "SAMRAI/SAMRAI_config.h"
+
+#include <cstddef>
+#include <memory>
+
+namespace SAMRAI {
+namespace tbox {
+
+/*!
+ * @brief A single contiguous allocation from which many smaller,
+ * aligned pieces are carved.
+ *
+ * A MemorySlab is sized once, at construction.  Pieces are handed out
+ * in order by carve() and are never individually freed; the whole slab
+ * is released when the last reference to it goes away.  Objects using
+ * storage carved from a slab should hold a std::shared_ptr to it so
+ * the slab outlives them.
+ *
+ * A slab may be made "active" with setActiveSlab().  While a slab is
+ * active, pdat::ArrayData takes its storage from that slab instead of
+ * the heap, falling back to the heap when the slab is exhausted.  This
+ * is how hier::PatchLevel places the data for one patch data component
+ * of all its local patches in a single allocation.  Activation is not
+ * thread-safe and is meant to bracket serial allocation loops.
+ *
+ * @see hier::PatchLevel::setUseSlabAllocation()
+ */
+class MemorySlab
+{
+public:
+   /*!
+    * @brief Alignment, in bytes, of the slab and of every carved piece.
+    */
+   static const size_t ALIGNMENT = 64;
+
+   /*!
+    * @brief Allocate a slab of at least the given size.
+    *
+    * @param[in] num_bytes
+    */
+   explicit MemorySlab(
+      size_t num_bytes);
+
+   /*!
+    * @brief Release the slab's memory.
+    */
+   ~MemorySlab();
+
+   /*!
+    * @brief Carve an aligned piece of the given size from the slab.
+    *
+    * @param[in] num_bytes
+    *
+    * @return Pointer to the piece, or 0 if the slab does not have
+    * room for it.
+    */
+   void *
+   carve(
+      size_t num_bytes);
+
+   /*!
+    * @brief Return the usable size of the slab, in bytes.
+    */
+   size_t
+   getSize() const
+   {
+      return d_size;
+   }
+
+   /*!
+    * @brief Return the number of bytes carved so far, including
+    * alignment padding.
+    */
+   size_t
+   getUsed() const
+   {
+      return d_used;
+   }
+
+   /*!
+    * @brief Return the number of pieces carved so far.
+    */
+   size_t
+   getNumberOfPieces() const
+   {
+      return d_num_pieces;
+   }
+
+   /*!
+    * @brief Return the slab from which ArrayData storage is currently
+    * carved, or a null pointer if there is none.
+    */
+   static const std::shared_ptr<MemorySlab>&
+   getActiveSlab()
+   {
+      return s_active_slab;
+   }
+
+   /*!
+    * @brief Set the slab from which ArrayData storage is carved.
+    *
+    * @param[in] slab  The new active slab, or a null pointer to go back
+    *                  to heap allocation.
+    */
+   static void
+   setActiveSlab(
+      const std::shared_ptr<MemorySlab>& slab)
+   {
+      s_active_slab = slab;
+   }
+
+private:
+   // Unimplemented default constructor.
+   MemorySlab();
+
+   // Unimplemented copy constructor.
+   MemorySlab(
+      const MemorySlab& other);
+
+   // Unimplemented assignment operator.
+   MemorySlab&
+   operator = (
+      const MemorySlab& rhs);
+
+   /*!
+    * @brief Memory as allocated, before alignment.
+    */
+   char* d_allocation;
+
+   /*!
+    * @brief Aligned start of the slab.
+    */
+   char* d_data;
+
+   /*!
+    * @brief Usable size of the slab.
+    */
+   size_t d_size;
+
+   /*!
+    * @brief Bytes carved so far.
+    */
+   size_t d_used;
+
+   /*!
+    * @brief Pieces carved so far.
+    */
+   size_t d_num_pieces;
+
+   static std::shared_ptr<MemorySlab> s_active_slab;
+};
+
+}
+}
+
+#endif
@@ -16,6 +16,10 @@
 #ifndef included_iostream
 #include <iostream>
 #endif
+#include <atomic>
+#include <cstddef>
+#include <string>
+#include <vector>
 
 namespace SAMRAI {
 namespace tbox {
@@ -33,6 +37,33 @@ namespace tbox {
  * single processor, the  call the print method is likely sufficient. The
  * information can simply be printed to a log file or output stream. 
  *
+ * The class also counts deferred memory: the size of patch data that
+ * have been requested with on-demand allocation but are not in memory,
+ * either because they have not been used yet or because they were
+ * released while idle.  The maximum of this count is the most memory
+ * on-demand allocation has saved at any time, and is printed by
+ * printMaxDeferredMemory().  See hier::PatchLevel::setUseOnDemandAllocation().
+ *
+ * When memory accounting is enabled, with setMemoryAccounting() or the
+ * SAMRAIManager input memory_accounting, the class also keeps the
+ * current and high-water memory of named accounts on each level.
+ * Patch data are charged, when a patch allocates them, to an account
+ * named after their patch data index ("variable##context") on the level
+ * of the patch, with the size given by their PatchDataFactory.  Other
+ * parts of the library charge accounts named after themselves:
+ *
+ * <ul>
+ *    <li> "RefineSchedule scratch" -- scratch, work and destination
+ *         data allocated by xfer::RefineSchedule while filling data
+ *    <li> "Connector" -- Connectors cached by
+ *         hier::PersistentOverlapConnectors
+ *    <li> "MessageStream buffers" -- buffers of tbox::MessageStream
+ * </ul>
+ *
+ * Memory not on a patch level is charged to level number NO_LEVEL.
+ * printMemoryAccounts() may be called at any time to print the accounts
+ * of the local processor.
+ *
  * Note that all member functions of this class are static so it is not
  * necessary to instantiate the class.  Simply call the functions as
  * static functions; e.g.,MemoryUtilities::function(...).
@@ -64,13 +95,236 @@ struct MemoryUtilities {
    align(
       const size_t bytes);
 
+   /*!
+    * Add to the count of deferred memory.
+    *
+    * @param bytes  Size of data now requested but not allocated.
+    */
+   static void
+   addDeferredMemory(
+      const size_t bytes);
+
+   /*!
+    * Subtract from the count of deferred memory.
+    *
+    * @param bytes  Size of data no longer deferred, because they have
+    *               been allocated or are no longer requested.
+    */
+   static void
+   removeDeferredMemory(
+      const size_t bytes)
+   {
+      s_deferred_memory -= bytes;
+   }
+
+   /*!
+    * Return the current count of deferred memory, in bytes.
+    */
+   static size_t
+   getDeferredMemory()
+   {
+      return s_deferred_memory;
+   }
+
+   /*!
+    * Return the maximum count of deferred memory, in bytes.
+    */
+   static size_t
+   getMaxDeferredMemory()
+   {
+      return s_max_deferred_memory;
+   }
+
+   /*!
+    * Print the maximum count of deferred memory on each processor to the
+    * supplied output stream.
+    */
+   static void
+   printMaxDeferredMemory(
+      std::ostream& os);
+
+   /*!
+    * Level number of memory not belonging to a patch level.
+    */
+   static const int NO_LEVEL = -1;
+
+   /*!
+    * Enable or disable memory accounting.  Memory charged while
+    * accounting is enabled is still credited after it is disabled.
+    */
+   static void
+   setMemoryAccounting(
+      bool enabled)
+   {
+      s_memory_accounting = enabled;
+   }
+
+   /*!
+    * Return whether memory accounting is enabled.
+    */
+   static bool
+   getMemoryAccounting()
+   {
+      return s_memory_accounting;
+   }
+
+   /*!
+    * Return the number of the memory account with the given name,
+    * creating the account if it does not exist.
+    *
+    * @param name
+    */
+   static int
+   getMemoryAccount(
+      const std::string& name);
+
+   /*!
+    * Add memory to an account.
+    *
+    * @param account  Number returned by getMemoryAccount().
+    * @param level_number  Level number, or NO_LEVEL.
+    * @param bytes
+    *
+    * @pre level_number >= NO_LEVEL
+    */
+   static void
+   chargeMemoryAccount(
+      int account,
+      int level_number,
+      size_t bytes);
+
+   /*!
+    * Subtract memory from an account.
+    *
+    * @param account  Number returned by getMemoryAccount().
+    * @param level_number  Level number, or NO_LEVEL.
+    * @param bytes  No more than was charged to the account and level.
+    *
+    * @pre level_number >= NO_LEVEL
+    */
+   static void
+   creditMemoryAccount(
+      int account,
+      int level_number,
+      size_t bytes);
+
+   /*!
+    * Return the memory currently charged to an account on a level.
+    *
+    * @param account  Number returned by getMemoryAccount().
+    * @param level_number  Level number, or NO_LEVEL.
+    */
+   static size_t
+   getAccountMemory(
+      int account,
+      int level_number);
+
+   /*!
+    * Return the high-water mark of an account on a level.
+    *
+    * @param account  Number returned by getMemoryAccount().
+    * @param level_number  Level number, or NO_LEVEL.
+    */
+   static size_t
+   getMaxAccountMemory(
+      int account,
+      int level_number);
+
+   /*!
+    * Reset the high-water marks of all accounts to their current memory,
+    * for instance to measure the high-water marks of one step.
+    */
+   static void
+   resetMaxAccountMemory();
+
+   /*!
+    * Print the current and high-water memory of each account and level
+    * with memory charged on this processor, and the current total of
+    * each level, to the supplied output stream.
+    */
+   static void
+   printMemoryAccounts(
+      std::ostream& os);
+
+   /*!
+    * @brief Charges patch data allocated in its lifetime to an account,
+    * instead of the accounts of their patch data indices.
+    *
+    * The account is used by all threads, so a ChargeScope should be
+    * created outside of parallel regions.  Scopes may be nested.
+    */
+   class ChargeScope
+   {
+public:
+      /*!
+       * @param account  Number returned by getMemoryAccount().
+       */
+      explicit ChargeScope(
+         int account):
+         d_previous_account(s_scope_account)
+      {
+         s_scope_account = account;
+      }
+
+      ~ChargeScope()
+      {
+         s_scope_account = d_previous_account;
+      }
+
+private:
+      // Unimplemented copy constructor.
+      ChargeScope(
+         const ChargeScope& other);
+
+      // Unimplemented assignment operator.
+      ChargeScope&
+      operator = (
+         const ChargeScope& rhs);
+
+      int d_previous_account;
+   };
+
+   /*!
+    * Return the account of the innermost ChargeScope, or -1 if there is
+    * none.
+    */
+   static int
+   getScopeAccount()
+   {
+      return s_scope_account;
+   }
+
 private:
+   /*
+    * Memory of an account, indexed by level number + 1.
+    */
+   struct MemoryAccount {
+      std::string d_name;
+      std::vector<size_t> d_memory;
+      std::vector<size_t> d_max_memory;
+   };
+
    /*
     * Keep track of maximum memory used (updated each time print function
     * called).
     */
    static double s_max_memory;
 
+   /*
+    * Current and maximum count of deferred memory.  These are updated
+    * by threads allocating patch data on demand.
+    */
+   static std::atomic<size_t> s_deferred_memory;
+   static std::atomic<size_t> s_max_deferred_memory;
+
+   /*
+    * Memory accounts.  These are changed in a critical section because
+    * patch data may be allocated by several threads.
+    */
+   static bool s_memory_accounting;
+   static std::vector<MemoryAccount> s_accounts;
+   static int s_scope_account;
+
    enum { ArenaAllocationAlignment = 16 };
 };
 
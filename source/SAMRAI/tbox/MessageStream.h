@@ -14,6 +14,7 @@
 #include "SAMRAI/SAMRAI_config.h"
 
 #include "SAMRAI/tbox/Complex.h"
+#include "SAMRAI/tbox/MemoryUtilities.h"
 #include "SAMRAI/tbox/Utilities.h"
 
 #ifdef HAVE_UMPIRE
@@ -197,6 +198,7 @@ public:
       if (num_bytes > 0) {
          d_write_buffer.resize(getCurrentSize() + num_bytes);
          d_buffer_size = d_write_buffer.size();
+         updateChargedMemory();
       }
       DATA_TYPE *buffer =
          reinterpret_cast<DATA_TYPE *>(&d_write_buffer[getCurrentSize()]);
@@ -384,6 +386,7 @@ private:
             static_cast<const char *>(input_data) + num_bytes);
          d_buffer_size = d_write_buffer.size();
          d_buffer_index += num_bytes;
+         updateChargedMemory();
       }
    }
 
@@ -404,6 +407,27 @@ private:
       d_buffer_index += num_bytes;
    }
 
+   /*!
+    * @brief Charge the "MessageStream buffers" account of
+    * MemoryUtilities for the write buffer if its capacity has changed.
+    */
+   void
+   updateChargedMemory()
+   {
+      if (d_charged_bytes != d_write_buffer.capacity() &&
+          (d_charged_bytes > 0 || MemoryUtilities::getMemoryAccounting())) {
+         chargeMemory(d_write_buffer.capacity());
+      }
+   }
+
+   /*!
+    * @brief Credit the memory charged so far and charge num_bytes if
+    * memory accounting is enabled.
+    */
+   void
+   chargeMemory(
+      size_t num_bytes);
+
    MessageStream(
       const MessageStream&);            // not implemented
    MessageStream&
@@ -455,6 +479,17 @@ private:
     */
    bool d_deep_copy_read;
 
+   /*!
+    * @brief Bytes charged to the "MessageStream buffers" memory account.
+    */
+   size_t d_charged_bytes;
+
+   /*!
+    * @brief Number of the "MessageStream buffers" memory account, -1
+    * until first used.
+    */
+   static int s_memory_account;
+
 };
 
 }
@@ -38,6 +38,7 @@
 
 #define TBOX_omp_get_num_threads() omp_get_num_threads()
 #define TBOX_omp_get_max_threads() omp_get_max_threads()
+#define TBOX_omp_get_thread_num() omp_get_thread_num()
 
 #define TBOX_IF_SINGLE_THREAD(CODE) \
    {   \
@@ -85,6 +86,7 @@
 
 #define TBOX_omp_get_num_threads() (1)
 #define TBOX_omp_get_max_threads() (1)
+#define TBOX_omp_get_thread_num() (0)
 
 #define TBOX_IF_SINGLE_THREAD(CODE) { CODE }
 
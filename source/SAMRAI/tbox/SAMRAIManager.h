@@ -48,7 +48,55 @@ namespace tbox {
  * run.
  *
  * Additionally this class manages static data that controls the maximum
- * number of patch data components that can be allowed.
+ * number of patch data components that can be allowed, and the tile size
+ * used by box loops run with tbox::policy::parallel.
+ *
+ * The tile size, and whether memory accounting is enabled, may be read
+ * from input by getFromInput():
+ *
+ * <b> Input Parameters </b>
+ *
+ * <b> Definitions: </b>
+ *    - \b    loop_tile_size
+ *       Integer array of up to three values giving the number of cells in
+ *       the i, j and k directions of the tiles that hier::for_all runs
+ *       2D and 3D box loops over under tbox::policy::parallel.  A value of
+ *       0 means the whole extent of the box, and missing values are
+ *       taken as 1.  Tiling that fits the cells
+ *       touched by a stencil in cache helps on large 3D patches.  This has
+ *       no effect when SAMRAI is built with RAJA, where tiling is chosen
+ *       at compile time with tbox::policy::tiled.
+ *    - \b    memory_accounting
+ *       Whether to keep per-variable and per-level memory accounts.  See
+ *       MemoryUtilities::printMemoryAccounts().
+ *
+ * <b> Details: </b> <br>
+ * <table>
+ *   <tr>
+ *     <th>parameter</th>
+ *     <th>type</th>
+ *     <th>default</th>
+ *     <th>range</th>
+ *     <th>opt/req</th>
+ *     <th>behavior on restart</th>
+ *   </tr>
+ *   <tr>
+ *     <td>loop_tile_size</td>
+ *     <td>int[]</td>
+ *     <td>0, 1, 1 (rows of the box)</td>
+ *     <td>each value >= 0</td>
+ *     <td>opt</td>
+ *     <td>Not written to restart. Value in input file used.</td>
+ *   </tr>
+ *   <tr>
+ *     <td>memory_accounting</td>
+ *     <td>bool</td>
+ *     <td>FALSE</td>
+ *     <td>TRUE, FALSE</td>
+ *     <td>opt</td>
+ *     <td>Not written to restart. Value in input file used.</td>
+ *   </tr>
+ * </table>
  *
  * @see SAMRAI_MPI
  * @see StartupShutdownManager
@@ -182,6 +230,48 @@ public:
    setMaxNumberPatchDataEntries(
       int maxnum);
 
+   /*!
+    * @brief Read the input parameters described in the class
+    * documentation.
+    *
+    * @param[in] input_db  Database with the parameters.  Nothing is done
+    *                      if it is null.
+    */
+   static void
+   getFromInput(
+      const std::shared_ptr<Database>& input_db);
+
+   /*!
+    * @brief Set the tile size of box loops run with
+    * tbox::policy::parallel.
+    *
+    * A size of 0 in a direction means the whole extent of the box.
+    *
+    * @param[in] tile_i
+    * @param[in] tile_j
+    * @param[in] tile_k
+    *
+    * @pre tile_i >= 0 && tile_j >= 0 && tile_k >= 0
+    */
+   static void
+   setLoopTileSize(
+      int tile_i,
+      int tile_j,
+      int tile_k);
+
+   /*!
+    * @brief Return the tile size in a direction of box loops run with
+    * tbox::policy::parallel.
+    *
+    * @param[in] d  Direction, 0, 1 or 2.
+    */
+   static int
+   getLoopTileSize(
+      int d)
+   {
+      return s_loop_tile_size[d];
+   }
+
 private:
    // Unimplemented default constructor.
    SAMRAIManager();
@@ -210,6 +300,11 @@ private:
     */
    static int s_max_patch_data_entries;
 
+   /*!
+    * Tile size of box loops run with tbox::policy::parallel.
+    */
+   static int s_loop_tile_size[3];
+
 
 };
 
@@ -159,6 +159,28 @@ private:
    operator = (
       const CoarsenCopyTransaction&);                   // not implemented
 
+   /*
+    * Allocate patch data of the destination type over the source region
+    * and copy the source values into it.  Used when the source and
+    * destination data cannot share a stream.
+    */
+   std::shared_ptr<hier::PatchData>
+   createConvertedSourceData() const;
+
+   /*
+    * Allocate patch data of the destination type over the given region.
+    */
+   std::shared_ptr<hier::PatchData>
+   allocateConvertedData(
+      const hier::Box& region) const;
+
+   /*
+    * Compute the size of the stream of converted source data, converting
+    * the source only when the size depends on the values.
+    */
+   size_t
+   computeConvertedSourceStreamSize();
+
    std::shared_ptr<hier::Patch> d_dst_patch;
    int d_dst_patch_rank;
    std::shared_ptr<hier::Patch> d_src_patch;
@@ -169,6 +191,19 @@ private:
    size_t d_incoming_bytes;
    size_t d_outgoing_bytes;
 
+   /*
+    * Whether the source data is converted to the destination type before
+    * it is packed, and the part of the source data that is converted.
+    */
+   bool d_convert_source;
+   hier::Box d_source_region;
+
+   /*
+    * Converted source data made while computing the outgoing message
+    * size, held until it is packed.
+    */
+   std::shared_ptr<hier::PatchData> d_converted_source;
+
 };
 
 }
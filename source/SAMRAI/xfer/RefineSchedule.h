@@ -495,6 +495,14 @@ private:
       const std::shared_ptr<hier::PatchLevel>& level,
       double fill_time) const;
 
+   /*!
+    * @brief Return the tbox::MemoryUtilities account that data allocated
+    * by the schedule is charged to, or -1 if memory accounting is not
+    * enabled.
+    */
+   static int
+   getScratchMemoryAccount();
+
    /*!
     * @brief Recursively fill the destination level with data at the
     * given time.
@@ -1248,6 +1256,16 @@ private:
    std::shared_ptr<hier::Connector> d_encon_to_src;
    const hier::Connector* d_dst_to_src;
 
+   /*!
+    * @brief Shared ownership of d_dst_to_src and its transpose when they
+    * come from the persistent overlap Connectors, so that they outlive
+    * any eviction from that cache.
+    *
+    * @see hier::PersistentOverlapConnectors::shareConnector()
+    */
+   std::shared_ptr<const hier::Connector> d_dst_to_src_share;
+   std::shared_ptr<const hier::Connector> d_src_to_dst_share;
+
    std::map<hier::BoxId, hier::IntVector> d_nbr_refine_ratio;
    std::map<hier::BoxId, hier::IntVector> d_encon_nbr_refine_ratio;
 
@@ -1340,6 +1358,12 @@ private:
     */
    static bool s_read_static_input;
 
+   /*!
+    * @brief Memory account of data allocated by schedules, -1 until
+    * first used.
+    */
+   static int s_scratch_memory_account;
+
    //@{
    /*!
     * @name Timer objects for performance measurement.
@@ -36,6 +36,11 @@ namespace xfer {
  * scratch data, all as defined in the RefineClasses class.  This transaction
  * is used by the refine schedule.
  *
+ * When the time interpolation operator can work over the overlap (see
+ * hier::TimeInterpolateOperator::canTimeInterpolateOverlap()), the
+ * interpolated values are packed or copied straight from the old and new
+ * source data.  Otherwise they are first computed in temporary patch data.
+ *
  * @see RefineSchedule
  * @see RefineClasses
  * @see tbox::Schedule
@@ -181,6 +186,14 @@ private:
 
    static double s_time;
 
+   /*
+    * Allocate patch data of the given component over d_box on a
+    * temporary patch owned by no process.
+    */
+   std::shared_ptr<hier::PatchData>
+   allocateTemporaryData(
+      int id) const;
+
    void
    timeInterpolate(
       hier::PatchData& pd_dst,
@@ -199,6 +212,12 @@ private:
    size_t d_incoming_bytes;
    size_t d_outgoing_bytes;
 
+   /*
+    * Whether values are converted to the type of the scratch data before
+    * they are packed.
+    */
+   bool d_convert_source;
+
 };
 
 }
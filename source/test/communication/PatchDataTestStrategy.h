@@ -19,6 +19,7 @@
 #include "SAMRAI/hier/Patch.h"
 #include "SAMRAI/hier/PatchHierarchy.h"
 #include "SAMRAI/hier/VariableContext.h"
+#include "SAMRAI/pdat/ArrayData.h"
 #include "SAMRAI/tbox/Database.h"
 
 #include <string>
@@ -243,6 +244,23 @@ public:
    }
 
 protected:
+   /*
+    * Return the ArrayData layout named by the depth_layout input of
+    * test variable i.
+    */
+   template<class TYPE>
+   typename pdat::ArrayData<TYPE>::DepthLayout
+   getDepthLayout(
+      int i) const
+   {
+      if (d_variable_depth_layout[i] == "INTERLEAVED") {
+         return pdat::ArrayData<TYPE>::INTERLEAVED;
+      } else if (d_variable_depth_layout[i] == "PADDED") {
+         return pdat::ArrayData<TYPE>::PADDED;
+      }
+      return pdat::ArrayData<TYPE>::PLANAR;
+   }
+
    const tbox::Dimension d_dim;
    /*
     * Vectors of information read from input file describing test variables
@@ -250,6 +268,7 @@ protected:
    std::vector<std::string> d_variable_src_name;
    std::vector<std::string> d_variable_dst_name;
    std::vector<int> d_variable_depth;
+   std::vector<std::string> d_variable_depth_layout;
    std::vector<hier::IntVector> d_variable_src_ghosts;
    std::vector<hier::IntVector> d_variable_dst_ghosts;
    std::vector<std::string> d_variable_coarsen_op;